@@ -0,0 +1,119 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     AdapterBenchmarks.cpp
+ * @date     Oct, 2026
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// rocoma
+#include "rocoma/controllers/ControllerAdapter.hpp"
+#include "rocoma/controllers/StaticControllerAdapter.hpp"
+
+// benchmark controllers
+#include "include/GainController.hpp"
+
+// STL
+#include <memory>
+
+namespace rocoma {
+
+using Adapter = ControllerAdapter<GainController<0>, RocoState, RocoCommand>;
+using StaticAdapter = StaticControllerAdapter<GainController<0>, RocoState, RocoCommand>;
+using UncheckedStaticAdapter =
+    StaticControllerAdapter<GainController<0>, RocoState, RocoCommand, NoCheckPolicy, ManualTimePolicy, PropagateExceptionPolicy>;
+
+//! Final adapters, as exported by ROCOMA_EXPORT_STATIC_CONTROLLER
+class FinalStaticAdapter final : public StaticAdapter {};
+class FinalUncheckedStaticAdapter final : public UncheckedStaticAdapter {};
+
+template <typename Adapter_>
+void setUpAdapter(Adapter_& adapter) {
+  adapter.setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), std::make_shared<RocoCommand>(),
+                             std::make_shared<boost::shared_mutex>());
+  adapter.createController(0.0004);
+  adapter.initializeController(0.0004);
+}
+
+//! Adapter exposing the advance of the controller, as baseline without adapter
+class DirectProbe : public Adapter {
+ public:
+  bool advanceDirect(double dt) { return GainController<0>::advance(dt); }
+};
+
+//! Direct (inlinable) call of the advance of the controller
+void advanceDirect(benchmark::State& state) {
+  DirectProbe probe;
+  setUpAdapter(probe);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(probe.advanceDirect(0.0004));
+  }
+  probe.cleanupController();
+}
+
+//! Advance through the adapter interface, as called by the controller manager
+template <typename Adapter_>
+void advanceThroughInterface(benchmark::State& state) {
+  Adapter_ adapter;
+  setUpAdapter(adapter);
+  roco::ControllerAdapterInterface* controller = &adapter;
+  benchmark::DoNotOptimize(controller);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(controller->advanceController(0.0004));
+  }
+  adapter.cleanupController();
+}
+
+//! Advance on the final type, the compiler can inline the whole advance
+template <typename Adapter_>
+void advanceFinal(benchmark::State& state) {
+  Adapter_ adapter;
+  setUpAdapter(adapter);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(adapter.advanceController(0.0004));
+  }
+  adapter.cleanupController();
+}
+
+BENCHMARK(advanceDirect);
+BENCHMARK_TEMPLATE(advanceThroughInterface, Adapter);
+BENCHMARK_TEMPLATE(advanceThroughInterface, StaticAdapter);
+BENCHMARK_TEMPLATE(advanceThroughInterface, UncheckedStaticAdapter);
+BENCHMARK_TEMPLATE(advanceFinal, FinalStaticAdapter);
+BENCHMARK_TEMPLATE(advanceFinal, FinalUncheckedStaticAdapter);
+
+}  // namespace rocoma
@@ -0,0 +1,214 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     ManagerBenchmarks.cpp
+ * @date     Oct, 2026
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// benchmark controllers
+#include "include/BenchmarkControllerManager.hpp"
+
+// STL
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+namespace rocoma {
+
+namespace {
+
+double toNanosecondsDouble(const TimingClock::duration& duration) {
+  return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count());
+}
+
+//! Adds the tail latencies of the iterations to the results [us]
+void setLatencyCounters(benchmark::State& state, const TimingStatistics& latencies) {
+  const LatencyStatistics statistics = latencies.getStatistics();
+  state.counters["p50_us"] = benchmark::Counter(1e6 * statistics.p50);
+  state.counters["p99_us"] = benchmark::Counter(1e6 * statistics.p99);
+  state.counters["p999_us"] = benchmark::Counter(1e6 * statistics.p999);
+  state.counters["max_us"] = benchmark::Counter(1e6 * statistics.max);
+  state.counters["overruns"] = benchmark::Counter(static_cast<double>(statistics.overruns));
+}
+
+void setLockFreeDispatch(benchmark::State& state, ControllerManagerOptions& options) {
+  options.lockFreeDispatch = state.range(1) != 0;
+}
+
+//! Adds the allocations per advance of the active controller to the results (requires ROCOMA_TRACK_ALLOCATIONS)
+void setAllocationCounters(benchmark::State& state, const ControllerManager& controllerManager) {
+  AllocationStatistics statistics;
+  if (!AllocationTracker::isAvailable() ||
+      !controllerManager.getControllerAllocationStatistics(BenchmarkControllerManager::getControllerName(0u), statistics) ||
+      statistics.numAdvances == 0u) {
+    return;
+  }
+  state.counters["allocationsPerAdvance"] =
+      benchmark::Counter(static_cast<double>(statistics.numAllocations) / static_cast<double>(statistics.numAdvances));
+}
+
+}  // namespace
+
+//! updateController with range(0) registered controllers, range(1) selects the lock-free dispatch
+void updateController(benchmark::State& state) {
+  BenchmarkControllerManager manager(static_cast<std::size_t>(state.range(0)), [&state](ControllerManagerOptions& options) {
+    setLockFreeDispatch(state, options);
+    options.allocationTrackingOptions.enable = AllocationTracker::isAvailable();
+  });
+  TimingStatistics latencies;
+  const std::uint64_t budget = toNanoseconds(BenchmarkControllerManager::timeStep_);
+  for (auto _ : state) {
+    const TimingClock::time_point start = TimingClock::now();
+    benchmark::DoNotOptimize(manager.get().updateController());
+    latencies.record(nanosecondsSince(start), budget);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+  setLatencyCounters(state, latencies);
+  setAllocationCounters(state, manager.get());
+}
+
+//! Switch between two controllers, the counters split the switch at the phases reaching the controllers [ns]
+void switchController(benchmark::State& state) {
+  BenchmarkControllerManager manager(2u);
+  const SwitchPhaseTimes& times = PhaseClockController::getTimes();
+  double untilPreStop = 0.0;
+  double preStopToSwap = 0.0;
+  double swapToStop = 0.0;
+  double stopToReturn = 0.0;
+  std::size_t nextController = 1u;
+  for (auto _ : state) {
+    const TimingClock::time_point start = TimingClock::now();
+    benchmark::DoNotOptimize(manager.get().switchController(BenchmarkControllerManager::getControllerName(nextController)));
+    const TimingClock::time_point end = TimingClock::now();
+    untilPreStop += toNanosecondsDouble(times.preStop_ - start);
+    preStopToSwap += toNanosecondsDouble(times.swap_ - times.preStop_);
+    swapToStop += toNanosecondsDouble(times.stop_ - times.swap_);
+    stopToReturn += toNanosecondsDouble(end - times.stop_);
+    nextController = 1u - nextController;
+  }
+  state.counters["untilPreStop_ns"] = benchmark::Counter(untilPreStop, benchmark::Counter::kAvgIterations);
+  state.counters["preStopToSwap_ns"] = benchmark::Counter(preStopToSwap, benchmark::Counter::kAvgIterations);
+  state.counters["swapToStop_ns"] = benchmark::Counter(swapToStop, benchmark::Counter::kAvgIterations);
+  state.counters["stopToReturn_ns"] = benchmark::Counter(stopToReturn, benchmark::Counter::kAvgIterations);
+}
+
+//! Emergency stop (range(0) == 0) or failproof stop (range(0) != 0) of a running controller
+void emergencyStop(benchmark::State& state) {
+  const bool isFailproofStop = state.range(0) != 0;
+  BenchmarkControllerManager manager(2u);
+  ControllerManager& controllerManager = manager.get();
+  TimingStatistics latencies;
+  for (auto _ : state) {
+    const TimingClock::time_point start = TimingClock::now();
+    benchmark::DoNotOptimize(isFailproofStop ? controllerManager.failproofStop() : controllerManager.emergencyStop());
+    latencies.record(nanosecondsSince(start), 0u);
+
+    state.PauseTiming();
+    controllerManager.waitForStoppedControllers(1.0);
+    controllerManager.clearEmergencyStop();
+    controllerManager.switchController(BenchmarkControllerManager::getControllerName(0u));
+    state.ResumeTiming();
+  }
+  setLatencyCounters(state, latencies);
+}
+
+//! updateController while another thread switches (range(0) == 0) or emergency stops and switches (range(0) != 0),
+//! range(1) selects the lock-free dispatch
+void updateControllerUnderContention(benchmark::State& state) {
+  const bool isEmergencyStopping = state.range(0) != 0;
+  BenchmarkControllerManager manager(2u, [&state](ControllerManagerOptions& options) { setLockFreeDispatch(state, options); });
+  ControllerManager& controllerManager = manager.get();
+
+  std::atomic_bool isContending{true};
+  std::thread contender([&controllerManager, &isContending, isEmergencyStopping]() {
+    std::size_t nextController = 1u;
+    while (isContending) {
+      if (isEmergencyStopping) {
+        controllerManager.emergencyStop();
+        controllerManager.waitForStoppedControllers(1.0);
+        controllerManager.clearEmergencyStop();
+      }
+      controllerManager.switchController(BenchmarkControllerManager::getControllerName(nextController));
+      nextController = 1u - nextController;
+    }
+  });
+
+  TimingStatistics latencies;
+  const std::uint64_t budget = toNanoseconds(BenchmarkControllerManager::timeStep_);
+  for (auto _ : state) {
+    const TimingClock::time_point start = TimingClock::now();
+    benchmark::DoNotOptimize(controllerManager.updateController());
+    latencies.record(nanosecondsSince(start), budget);
+  }
+  isContending = false;
+  contender.join();
+  setLatencyCounters(state, latencies);
+}
+
+//! Reads the status (range(0) == 0) or copies the active controller name (range(0) != 0) while another thread ticks
+void readStatus(benchmark::State& state) {
+  const bool isReadingName = state.range(0) != 0;
+  BenchmarkControllerManager manager(2u);
+  ControllerManager& controllerManager = manager.get();
+
+  std::atomic_bool isTicking{true};
+  std::thread ticker([&controllerManager, &isTicking]() {
+    while (isTicking) {
+      controllerManager.updateController();
+    }
+  });
+
+  for (auto _ : state) {
+    if (isReadingName) {
+      benchmark::DoNotOptimize(controllerManager.getActiveControllerName());
+    } else {
+      benchmark::DoNotOptimize(controllerManager.getStatus());
+    }
+  }
+  isTicking = false;
+  ticker.join();
+}
+
+BENCHMARK(updateController)->RangeMultiplier(10)->Ranges({{1, 1000}, {0, 1}})->ArgNames({"controllers", "lockFree"});
+BENCHMARK(switchController);
+BENCHMARK(emergencyStop)->Arg(0)->Arg(1)->ArgName("failproof");
+BENCHMARK(updateControllerUnderContention)->Ranges({{0, 1}, {0, 1}})->ArgNames({"emergencyStops", "lockFree"})->UseRealTime();
+BENCHMARK(readStatus)->Arg(0)->Arg(1)->ArgName("name")->UseRealTime();
+
+}  // namespace rocoma
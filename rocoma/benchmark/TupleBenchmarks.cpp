@@ -0,0 +1,108 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     TupleBenchmarks.cpp
+ * @date     Oct, 2026
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// roco
+#include "roco/controllers/ControllerTuple.hpp"
+
+// rocoma
+#include "rocoma/controllers/ControllerAdapter.hpp"
+#include "rocoma/controllers/StaticControllerTuple.hpp"
+
+// benchmark controllers
+#include "include/GainController.hpp"
+
+// STL
+#include <memory>
+
+namespace rocoma {
+
+using RocoControllerTuple =
+    roco::ControllerTuple<RocoState, RocoCommand, GainController<0>, GainController<1>, GainController<2>, GainController<3>>;
+using RocomaStaticControllerTuple =
+    StaticControllerTuple<RocoState, RocoCommand, GainController<0>, GainController<1>, GainController<2>, GainController<3>>;
+
+//! Adapter exposing the advance of the tuple, to measure it without the locking and checks of the adapter
+template <typename Tuple_>
+class TupleProbe : public ControllerAdapter<Tuple_, RocoState, RocoCommand> {
+ public:
+  TupleProbe() {
+    this->setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), std::make_shared<RocoCommand>(),
+                             std::make_shared<boost::shared_mutex>());
+    this->createController(dt_);
+    this->initializeController(dt_);
+  }
+  ~TupleProbe() override { this->cleanupController(); }
+
+  bool advanceTuple() { return Tuple_::advance(dt_); }
+  bool advanceAdapter() { return this->advanceController(dt_); }
+
+ private:
+  static constexpr double dt_ = 0.0004;
+};
+
+template <typename Tuple_>
+constexpr double TupleProbe<Tuple_>::dt_;
+
+//! Advance of the tuple only (one virtual call into the tuple)
+template <typename Tuple_>
+void advanceTuple(benchmark::State& state) {
+  TupleProbe<Tuple_> probe;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(probe.advanceTuple());
+  }
+}
+
+//! Advance through the adapter, as called by the controller manager
+template <typename Tuple_>
+void advanceAdapter(benchmark::State& state) {
+  TupleProbe<Tuple_> probe;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(probe.advanceAdapter());
+  }
+}
+
+BENCHMARK_TEMPLATE(advanceTuple, RocoControllerTuple);
+BENCHMARK_TEMPLATE(advanceTuple, RocomaStaticControllerTuple);
+BENCHMARK_TEMPLATE(advanceAdapter, RocoControllerTuple);
+BENCHMARK_TEMPLATE(advanceAdapter, RocomaStaticControllerTuple);
+
+}  // namespace rocoma
@@ -0,0 +1,68 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     benchmark_main.cpp
+ * @date     Oct, 2026
+ */
+
+// benchmark
+#include <benchmark/benchmark.h>
+
+// STL
+#include <cstring>
+#include <vector>
+
+//! Runs the benchmarks and writes the results to rocoma_benchmarks.json unless --benchmark_out is given
+int main(int argc, char** argv) {
+  std::vector<char*> arguments(argv, argv + argc);
+  bool hasOutput = false;
+  for (int i = 1; i < argc; ++i) {
+    hasOutput = hasOutput || std::strncmp(argv[i], "--benchmark_out=", std::strlen("--benchmark_out=")) == 0;
+  }
+  char defaultOutput[] = "--benchmark_out=rocoma_benchmarks.json";
+  char defaultOutputFormat[] = "--benchmark_out_format=json";
+  if (!hasOutput) {
+    arguments.push_back(defaultOutput);
+    arguments.push_back(defaultOutputFormat);
+  }
+
+  int numArguments = static_cast<int>(arguments.size());
+  benchmark::Initialize(&numArguments, arguments.data());
+  if (benchmark::ReportUnrecognizedArguments(numArguments, arguments.data())) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,171 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     BenchmarkControllerManager.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// rocoma
+#include "rocoma/ControllerManager.hpp"
+#include "rocoma/common/TimingStatistics.hpp"
+#include "rocoma/controllers/adapters.hpp"
+
+// benchmark controllers
+#include "GainController.hpp"
+
+// test
+#include "test/include/EmergencyController.hpp"
+#include "test/include/FailProofController.hpp"
+
+// STL
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+
+namespace rocoma {
+
+//! Times at which the phases of the last switch reached the controllers
+struct SwitchPhaseTimes {
+  TimingClock::time_point preStop_;
+  TimingClock::time_point swap_;
+  TimingClock::time_point stop_;
+};
+
+//! Controller recording when it is stopped and swapped in
+class PhaseClockController : virtual public roco::Controller<RocoState, RocoCommand> {
+ public:
+  static SwitchPhaseTimes& getTimes() {
+    static SwitchPhaseTimes times;
+    return times;
+  }
+
+ protected:
+  bool create(double /*dt*/) override { return true; }
+  bool initialize(double /*dt*/) override {
+    getTimes().swap_ = TimingClock::now();
+    return true;
+  }
+  bool advance(double /*dt*/) override { return true; }
+  bool reset(double /*dt*/) override { return true; }
+  bool preStop() override {
+    getTimes().preStop_ = TimingClock::now();
+    return true;
+  }
+  bool stop() override {
+    getTimes().stop_ = TimingClock::now();
+    return true;
+  }
+  bool cleanup() override { return true; }
+  bool swap(double dt, const roco::ControllerSwapStateInterfacePtr& /*swapState*/) override { return initialize(dt); }
+};
+
+//! Controller manager with a configurable number of controllers, no ROS and no logger
+/*! The first two controllers record the phases of a switch (see PhaseClockController) and share an emergency controller,
+ *  the other ones are gain controllers without emergency controller. The first controller is active after construction.
+ */
+class BenchmarkControllerManager {
+ public:
+  using OptionsModifier = std::function<void(ControllerManagerOptions&)>;
+  using PhaseClockCtrl = ControllerAdapter<PhaseClockController, RocoState, RocoCommand>;
+  using GainCtrl = ControllerAdapter<GainController<0>, RocoState, RocoCommand>;
+  using EmergencyCtrl = EmergencyControllerAdapter<EmergencyController, RocoState, RocoCommand>;
+  using FailproofCtrl = FailproofControllerAdapter<FailProofController, RocoState, RocoCommand>;
+
+  static constexpr double timeStep_ = 0.0004;
+
+  explicit BenchmarkControllerManager(std::size_t numControllers,
+                                      const OptionsModifier& modifyOptions = [](ControllerManagerOptions& /*options*/) {})
+      : manager_(),
+        state_(std::make_shared<RocoState>()),
+        command_(std::make_shared<RocoCommand>()),
+        stateMutex_(std::make_shared<boost::shared_mutex>()),
+        commandMutex_(std::make_shared<boost::shared_mutex>()) {
+    ControllerManagerOptions options;
+    options.timeStep = timeStep_;
+    options.isRealRobot = false;
+    options.loggerOptions.enable = false;
+    modifyOptions(options);
+    manager_.init(options);
+
+    std::unique_ptr<FailproofCtrl> failproofController(new FailproofCtrl());
+    setUp(*failproofController, "FailproofController");
+    manager_.setFailproofController(std::move(failproofController));
+
+    std::unique_ptr<EmergencyCtrl> emergencyController(new EmergencyCtrl());
+    setUp(*emergencyController, "EmergencyController");
+    for (std::size_t i = 0u; i < numControllers; ++i) {
+      if (i < 2u) {
+        std::unique_ptr<PhaseClockCtrl> controller(new PhaseClockCtrl());
+        setUp(*controller, getControllerName(i));
+        if (i == 0u) {
+          manager_.addControllerPair(std::move(controller), std::move(emergencyController));
+        } else {
+          manager_.addControllerPairWithExistingEmergencyController(std::move(controller), "EmergencyController");
+        }
+      } else {
+        std::unique_ptr<GainCtrl> controller(new GainCtrl());
+        setUp(*controller, getControllerName(i));
+        manager_.addControllerPair(std::move(controller), nullptr);
+      }
+    }
+    manager_.switchController(getControllerName(0u));
+  }
+
+  ~BenchmarkControllerManager() { manager_.cleanup(); }
+
+  static std::string getControllerName(std::size_t i) { return "Controller" + std::to_string(i); }
+
+  ControllerManager& get() { return manager_; }
+
+ private:
+  template <typename Controller_>
+  void setUp(Controller_& controller, const std::string& name) {
+    controller.setName(name);
+    controller.setStateAndCommand(state_, stateMutex_, command_, commandMutex_);
+  }
+
+  ControllerManager manager_;
+  std::shared_ptr<RocoState> state_;
+  std::shared_ptr<RocoCommand> command_;
+  std::shared_ptr<boost::shared_mutex> stateMutex_;
+  std::shared_ptr<boost::shared_mutex> commandMutex_;
+};
+
+constexpr double BenchmarkControllerManager::timeStep_;
+
+}  // namespace rocoma
@@ -0,0 +1,74 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     GainController.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// roco
+#include "roco/controllers/controllers.hpp"
+
+// test
+#include "test/include/RocoCommand.hpp"
+#include "test/include/RocoState.hpp"
+
+namespace rocoma {
+
+//! Small and fast controller, as found in tuples of filters and feedback terms
+template <int Id_>
+class GainController : virtual public roco::Controller<RocoState, RocoCommand> {
+ protected:
+  bool create(double /*dt*/) override { return true; }
+  bool initialize(double /*dt*/) override { return true; }
+  bool advance(double /*dt*/) override {
+    RocoCommand& command = this->getCommand();
+    command.setValue(0.5 * command.getValue() + gain_ * this->getState().getValue());
+    return true;
+  }
+  bool reset(double /*dt*/) override { return true; }
+  bool preStop() override { return true; }
+  bool stop() override { return true; }
+  bool cleanup() override { return true; }
+
+ private:
+  static constexpr double gain_ = 0.1 * (Id_ + 1);
+};
+
+template <int Id_>
+constexpr double GainController<Id_>::gain_;
+
+}  // namespace rocoma
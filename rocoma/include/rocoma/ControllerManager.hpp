@@ -33,6 +33,20 @@
 
 #pragma once
 
+// rocoma
+#include "rocoma/common/AllocationTracker.hpp"
+#include "rocoma/common/AsyncLogSink.hpp"
+#include "rocoma/common/BoundedQueue.hpp"
+#include "rocoma/common/ControllerRegistry.hpp"
+#include "rocoma/common/RcuCell.hpp"
+#include "rocoma/common/Semaphore.hpp"
+#include "rocoma/common/SeqLock.hpp"
+#include "rocoma/common/StopExecutor.hpp"
+#include "rocoma/common/TickDriver.hpp"
+#include "rocoma/common/TimingStatistics.hpp"
+#include "rocoma/controllers/HotStandbyInterface.hpp"
+#include "rocoma/controllers/ShadowInterface.hpp"
+
 // roco
 #include <roco/controllers/controllers.hpp>
 
@@ -46,14 +60,18 @@
 #include <boost/thread/shared_mutex.hpp>
 
 // STL
+#include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
+#include <functional>
 #include <future>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace rocoma {
@@ -74,6 +92,49 @@ struct LoggerOptions {
   signal_logger::LogFileTypeSet fileTypes{signal_logger::LogFileType::BINARY};  // NOLINT(readability-identifier-naming)
 };
 
+//! Reaction of the manager if a controller exceeds its time budget
+enum class OverrunPolicy : int { COUNT = 0, WARN = 1, EMERGENCY_STOP = 2, FAILPROOF_STOP = 3 };
+
+//! Deadline monitoring options
+struct DeadlineOptions {
+  //! Default constructor
+  DeadlineOptions() = default;
+
+  //! Copy constructor
+  DeadlineOptions(const DeadlineOptions& other) = default;
+
+  //! Check the advance duration of the active controller against its budget
+  bool enable{false};  // NOLINT(readability-identifier-naming)
+  //! Budget of controllers without an entry in budgets [s] (non-positive -> timeStep)
+  double defaultBudget{0.0};  // NOLINT(readability-identifier-naming)
+  //! Budgets per controller name [s]
+  std::unordered_map<std::string, double> budgets{};  // NOLINT(readability-identifier-naming)
+  //! Reaction on overrun
+  OverrunPolicy overrunPolicy{OverrunPolicy::COUNT};  // NOLINT(readability-identifier-naming)
+  //! Number of consecutive overruns that trigger an emergency stop (OverrunPolicy::EMERGENCY_STOP)
+  unsigned int maxConsecutiveOverruns{3u};  // NOLINT(readability-identifier-naming)
+  //! Failproof stop if updateController was not called for this duration [s] (non-positive -> no watchdog)
+  double heartbeatTimeout{0.0};  // NOLINT(readability-identifier-naming)
+  //! Priority of the heartbeat watchdog thread
+  int watchdogPriority{0};  // NOLINT(readability-identifier-naming)
+};
+
+//! Allocation tracking options (requires the allocation interposer, see AllocationTracker)
+struct AllocationTrackingOptions {
+  //! Default constructor
+  AllocationTrackingOptions() = default;
+
+  //! Copy constructor
+  AllocationTrackingOptions(const AllocationTrackingOptions& other) = default;
+
+  //! Count the allocations of every advance of the active controller
+  bool enable{false};  // NOLINT(readability-identifier-naming)
+  //! Abort on the first allocation of an advance in the steady state
+  bool abortOnAllocation{false};  // NOLINT(readability-identifier-naming)
+  //! Number of advances of a controller before it is in the steady state
+  unsigned int warmupAdvances{100u};  // NOLINT(readability-identifier-naming)
+};
+
 //! Options struct to initialize manager
 struct ControllerManagerOptions {
   //! Default Constructor
@@ -90,6 +151,120 @@ struct ControllerManagerOptions {
   LoggerOptions loggerOptions{};  // NOLINT(readability-identifier-naming)
   //! Emergency stop has to cleared
   bool emergencyStopMustBeCleared{false};  // NOLINT(readability-identifier-naming)
+  //! Read the active controller lock-free in updateController (updateController must then be called from a single thread)
+  bool lockFreeDispatch{false};  // NOLINT(readability-identifier-naming)
+  //! Time updateController and the advance of every controller (overrun if longer than timeStep)
+  bool collectTimingStatistics{false};  // NOLINT(readability-identifier-naming)
+  //! Deadline monitoring options
+  DeadlineOptions deadlineOptions{};  // NOLINT(readability-identifier-naming)
+  //! Allocation tracking options
+  AllocationTrackingOptions allocationTrackingOptions{};  // NOLINT(readability-identifier-naming)
+  //! Format the lifecycle and emergency stop messages on a background thread (see AsyncLogSink)
+  bool asyncLogging{false};  // NOLINT(readability-identifier-naming)
+  //! Call the notify functions and the listeners on a dedicated thread instead of the thread causing the transition
+  bool asyncNotifications{false};  // NOLINT(readability-identifier-naming)
+  //! Scheduling options of the built-in tick driver (see start() and run())
+  TickDriverOptions tickDriverOptions{};  // NOLINT(readability-identifier-naming)
+  //! Initialize the new controller while the old one keeps running, pre-stop the old one after the first tick of the new one
+  bool makeBeforeBreakSwitch{false};  // NOLINT(readability-identifier-naming)
+  //! Stop the controllers left by an emergency stop on a dedicated thread instead of the calling (tick) thread
+  bool stopControllersAsynchronously{false};  // NOLINT(readability-identifier-naming)
+  //! Maximal time switching and cleanup wait for a controller that is being stopped [s]
+  double controllerStopTimeout{10.0};  // NOLINT(readability-identifier-naming)
+  //! Maximal number of threads creating controllers in addControllerPairs (0 -> number of cores)
+  //! Only raise the limit if create() of all registered controllers is thread safe, the default creates them serially
+  unsigned int maxCreationThreads{1u};  // NOLINT(readability-identifier-naming)
+  //! Create controllers on the first switch to them instead of on registration (emergency controllers are always created)
+  bool lazyControllerCreation{false};  // NOLINT(readability-identifier-naming)
+  //! Create the lazily registered controllers ahead of their first switch on an idle priority thread
+  bool createAheadInBackground{false};  // NOLINT(readability-identifier-naming)
+  //! Advance the emergency controller of the active pair in shadow, an emergency stop then only hands over its last command
+  bool hotStandbyEmergencyControllers{false};  // NOLINT(readability-identifier-naming)
+  //! Scheduling options of the thread advancing the emergency controller in shadow (e.g. pin it to a spare core)
+  TickDriverOptions hotStandbyTickDriverOptions{};  // NOLINT(readability-identifier-naming)
+  //! Scheduling options of the thread advancing the shadow controller (see attachShadowController)
+  TickDriverOptions shadowTickDriverOptions{};  // NOLINT(readability-identifier-naming)
+};
+
+//! Result of creating a single controller in ControllerManager::addControllerPairs
+struct ControllerCreationResult {
+  //! Name of the controller
+  std::string controllerName_;
+  //! True, iff the controller is an emergency controller
+  bool isEmergencyController_{false};
+  //! True, iff createController succeeded
+  bool success_{false};
+  //! Duration of createController [s]
+  double createTime_{0.0};
+  //! True, iff creation is deferred to the first switch (see lazyControllerCreation)
+  bool isCreationDeferred_{false};
+};
+
+//! Bookkeeping of the lazily created controllers (see lazyControllerCreation)
+struct LazyCreationReport {
+  //! Number of controllers registered without being created
+  unsigned int numRegisteredControllers_{0u};
+  //! Number of those controllers that were created since (on a switch or ahead in the background)
+  unsigned int numCreatedControllers_{0u};
+  //! Accumulated duration of createController of the created controllers [s]
+  double createTime_{0.0};
+  //! Accumulated increase of the resident memory while creating them [bytes]
+  std::int64_t residentMemory_{0};
+};
+
+//! Report of the controller running in shadow of the active one (see ControllerManager::attachShadowController)
+struct ShadowReport {
+  //! Name of the shadow controller
+  std::string controllerName_;
+  //! Number of ticks the shadow controller was advanced in
+  std::uint64_t numTicks_{0u};
+  //! Number of failed advances
+  std::uint64_t numFailedTicks_{0u};
+  //! Duration of the advance in shadow
+  LatencyStatistics advance_;
+  //! True, iff a divergence is defined for the command type (see CommandDivergence)
+  bool hasCommandDivergence_{false};
+  //! Divergence of the shadow command from the command of the active controller
+  double lastCommandDivergence_{0.0};
+  double meanCommandDivergence_{0.0};
+  double maxCommandDivergence_{0.0};
+};
+
+//! Timing report of a single controller
+struct ControllerTimingReport {
+  //! Duration of advanceController as measured by the manager
+  LatencyStatistics advanceController_;
+  //! True, iff the adapter provides the timings of its phases (see ControllerAdapterExtensionInterface)
+  bool hasPhaseTimings_{false};
+  //! Duration of state check, adaptee advance and command limiting
+  LatencyStatistics updateState_;
+  LatencyStatistics advance_;
+  LatencyStatistics updateCommand_;
+};
+
+//! Runtime statistics of a single controller (see ControllerManager::getStatistics)
+struct ControllerStatistics {
+  //! Name of the controller, emergency controller or failproof controller
+  std::string controllerName_;
+  //! Number of ticks the controller was advanced in since it was registered
+  std::uint64_t numTicks_{0u};
+  //! Duration of advanceController (requires collectTimingStatistics or deadline monitoring)
+  LatencyStatistics advanceController_;
+};
+
+//! Runtime statistics of the manager, collected lock-free by the control loop (see ControllerManager::getStatistics)
+struct ControllerManagerStatistics {
+  //! Number of ticks that advanced a controller
+  std::uint64_t tickCount_{0u};
+  //! Duration of updateController and its wait for the controller locks (requires collectTimingStatistics)
+  LatencyStatistics updateController_;
+  LatencyStatistics updateControllerLockWait_;
+  //! Duration of the successful switches, from the request to the activation of the new controller
+  LatencyStatistics switchController_;
+  //! Latency from entering an emergency stop to the first command of the emergency or failproof controller
+  LatencyStatistics emergencyStop_;
+  //! Controllers, emergency controllers and the failproof controller in registration order
+  std::vector<ControllerStatistics> controllers_;
 };
 
 //! Implementation of a controllermanager for adater interfaces
@@ -104,25 +279,101 @@ class ControllerManager {
   //! Enumeration indicating the emergency stop type
   enum class EmergencyStopType : int { FAILPROOF = -2, EMERGENCY = -1, NA = 0 };
 
+  //! Status of the manager, published on every transition and read without locks (see getStatus)
+  struct Status {
+    //! Number of published transitions
+    std::uint64_t version_{0u};
+    //! State of the manager
+    State state_{State::FAILURE};
+    //! Id of the controller of the active pair (invalidControllerId before the first switch)
+    ControllerId activeControllerId_{invalidControllerId};
+    //! Name of the active controller, owned by the manager (nullptr before construction finished)
+    const std::string* activeControllerName_{nullptr};
+    //! Cleared emergency stop flag
+    bool clearedEmergencyStop_{false};
+    //! Time of the last change of the state or the active controller [ns since epoch of TimingClock]
+    std::int64_t lastSwitchTime_{0};
+    //! Number of ticks that advanced a controller (read by getStatus, does not increment the version)
+    std::uint64_t tickCount_{0u};
+  };
+
+  //! Listener of the transitions of the manager, called in the order of the transitions (see addListener)
+  class Listener {
+   public:
+    virtual ~Listener() = default;
+
+    //! Called on every emergency stop
+    virtual void onEmergencyStop(EmergencyStopType /*type*/) {}
+    //! Called when a controller became active
+    virtual void onControllerChanged(const std::string& /*newControllerName*/) {}
+    //! Called when the state of the manager or the cleared emergency stop flag changed
+    virtual void onControllerManagerStateChanged(State /*state*/, bool /*clearedEmergencyStop*/) {}
+  };
+
  protected:
+  //! Timing and deadline bookkeeping of a controller
+  struct ControllerMonitor {
+    //! Advance durations
+    TimingStatistics timing_;
+    //! Time budget of the advance [ns]
+    std::uint64_t budget_{0u};
+    //! Number of consecutive overruns (only accessed by updateController)
+    unsigned int consecutiveOverruns_{0u};
+    //! Time of the last logged overrun (only accessed by updateController)
+    TimingClock::time_point lastOverrunLog_{};
+    //! Allocations of the advances
+    AllocationCounter allocations_;
+    //! Number of advances (counted even if the timings are not measured)
+    std::atomic<std::uint64_t> numTicks_{0u};
+  };
+
+  //! Transition passed to the notifier thread
+  struct Notification {
+    enum class Type : int { EMERGENCY_STOP, CONTROLLER_CHANGED, STATE_CHANGED };
+    Type type_{Type::STATE_CHANGED};
+    EmergencyStopType emergencyStopType_{EmergencyStopType::NA};
+    State state_{State::NA};
+    bool clearedEmergencyStop_{false};
+    //! Name owned by the manager (controller changed only)
+    const std::string* controllerName_{nullptr};
+  };
+
   //! Set of controller pointers (normal and emergency controller)
   struct ControllerSetPtr {
     ControllerSetPtr(roco::ControllerAdapterInterface* controller, roco::EmergencyControllerAdapterInterface* emgcyController)
-        : controller_(controller),
-          emgcyController_(emgcyController),
-          controllerName_(controller != nullptr ? controller->getControllerName().c_str() : "none"),
-          emgcyControllerName_(emgcyController != nullptr ? emgcyController->getControllerName().c_str() : "none") {}
+        : controller_(controller), emgcyController_(emgcyController) {}
+
+    //! Name of a missing controller
+    static const std::string& getNoneName() {
+      static const std::string noneName("none");
+      return noneName;
+    }
 
     roco::ControllerAdapterInterface* controller_;
     roco::EmergencyControllerAdapterInterface* emgcyController_;
-    std::string controllerName_;
-    std::string emgcyControllerName_;
+    //! Id of the controller in the registry
+    ControllerId controllerId_{invalidControllerId};
+    //! Names owned by the registries, copying the set copies no strings
+    const std::string* controllerName_{&getNoneName()};
+    const std::string* emgcyControllerName_{&getNoneName()};
+    ControllerMonitor* controllerMonitor_{nullptr};
+    ControllerMonitor* emgcyControllerMonitor_{nullptr};
+  };
+
+  //! Snapshot of the state and active controllers as seen by updateController
+  struct DispatchRecord {
+    State state_{State::FAILURE};
+    roco::ControllerAdapterInterface* controller_{nullptr};
+    roco::EmergencyControllerAdapterInterface* emgcyController_{nullptr};
+    ControllerMonitor* controllerMonitor_{nullptr};
+    ControllerMonitor* emgcyControllerMonitor_{nullptr};
   };
 
   //! Convenience typedef for Controller
   using ControllerPtr = std::unique_ptr<roco::ControllerAdapterInterface>;
   using EmgcyControllerPtr = std::unique_ptr<roco::EmergencyControllerAdapterInterface>;
   using FailproofControllerPtr = std::unique_ptr<roco::FailproofControllerAdapterInterface>;
+  using ControllerPairPtr = std::pair<ControllerPtr, EmgcyControllerPtr>;
 
  public:
   /**
@@ -137,7 +388,7 @@ class ControllerManager {
   explicit ControllerManager(const ControllerManagerOptions& options);
 
   //! Destructor
-  virtual ~ControllerManager() = default;
+  virtual ~ControllerManager();
 
   /**
    * @brief Initializes the controller manager
@@ -160,6 +411,24 @@ class ControllerManager {
    */
   bool addControllerPairWithExistingEmergencyController(ControllerPtr&& controller, const std::string& emgcyControllerName);
 
+  /**
+   * @brief Add controller pairs to the manager, the controllers are created on up to maxCreationThreads threads
+   *        The first emergency controller with a given name is used for all pairs referring to that name.
+   * @param controllerPairs  Controller pairs (unique ptrs -> ownership transfer)
+   * @param results          Optional, create time and success of every created controller
+   * @return true, if all controllers were created and added successfully
+   */
+  bool addControllerPairs(std::vector<ControllerPairPtr>&& controllerPairs, std::vector<ControllerCreationResult>* results = nullptr);
+
+  /**
+   * @brief Replaces a registered controller by a new instance with the same name, e.g. to reload a controller plugin.
+   *        The new instance is created in the calling thread. An inactive controller is exchanged atomically, an active controller
+   *        hands over to the new instance with a make-before-break switch. The old instance is cleaned up and destroyed.
+   * @param controller  New instance of the controller (unique ptr -> ownership transfer, destroyed if the replacement fails)
+   * @return true, iff the new instance was created and replaced the old one
+   */
+  bool replaceController(ControllerPtr&& controller);
+
   /**
    * @brief Sets the failproof controller
    * @param controller             Pointer to the failproof controller (unique ptr -> ownership transfer)
@@ -173,6 +442,73 @@ class ControllerManager {
    */
   bool updateController();
 
+  /**
+   * @brief Calls updateController every time step in a real-time thread (absolute deadlines, no drift)
+   * @return true, iff the tick driver was started
+   */
+  bool start();
+
+  /**
+   * @brief Calls updateController every time step in the calling thread until stop() is called
+   * @return false, iff the tick driver is already running
+   */
+  bool run();
+
+  /**
+   * @brief Stops the tick driver after the current tick
+   */
+  void stop();
+
+  /**
+   * @brief Missed deadlines and wakeup latency observed by the tick driver (can be called from any thread)
+   */
+  TickDriverStatistics getTickDriverStatistics() const;
+
+  /**
+   * @brief Number, create time and memory of the lazily created controllers (can be called from any thread)
+   */
+  LazyCreationReport getLazyCreationReport() const;
+
+  /**
+   * @brief Number of controller change and state notifications dropped because the queue of the notifier thread was full
+   *        (emergency stops are never dropped, can be called from any thread)
+   */
+  std::uint64_t getNumDroppedNotifications() const { return numDroppedNotifications_.load(std::memory_order_relaxed); }
+
+  /**
+   * @brief Latency from entering an emergency stop to the first command of the emergency or failproof controller
+   * @return statistics of the emergency stops, can be called from any thread
+   */
+  LatencyStatistics getEmergencyStopLatencyStatistics() const;
+
+  /**
+   * @brief Advances a registered controller in shadow of the active one, against a state snapshot and a private command.
+   *        It is advanced on a separate thread once per tick, switching to it promotes it and ends the shadow execution.
+   * @param controllerName  Name of the controller (must not be active)
+   * @return true, iff the controller runs in shadow
+   */
+  bool attachShadowController(const std::string& controllerName);
+
+  /**
+   * @brief Stops advancing the shadow controller
+   * @return true, iff a shadow controller was attached
+   */
+  bool detachShadowController();
+
+  /**
+   * @brief Advance times and command divergence of the shadow controller
+   * @param report  Report of the shadow controller
+   * @return true, iff a shadow controller is attached
+   */
+  bool getShadowReport(ShadowReport& report) const;
+
+  /**
+   * @brief Waits until the controllers left by emergency stops are stopped (see stopControllersAsynchronously)
+   * @param timeout  Maximal waiting time [s]
+   * @return true, iff no controller stop is pending
+   */
+  bool waitForStoppedControllers(double timeout);
+
   /**
    * @brief Go to emergency controller if it exists
    * @return true, iff successful
@@ -211,7 +547,29 @@ class ControllerManager {
   void switchController(const std::string& controllerName, std::promise<SwitchResponse>& response_promise);
 
   /**
-   * @brief Get a vector of all available controller names
+   * @brief Tries to switch to a desired controller without looking up its name
+   * @param controllerId    Id of the desired controller (see getControllerId)
+   * @return result of the switching operation
+   */
+  SwitchResponse switchController(ControllerId controllerId);
+
+  /**
+   * @brief Tries to switch to a desired controller without looking up its name
+   * @param controllerId      Id of the desired controller (see getControllerId)
+   * @param response_promise  Reference to a promise in which the result will be stored in (Lifetime of response_promise must be taken care
+   * of)
+   */
+  void switchController(ControllerId controllerId, std::promise<SwitchResponse>& response_promise);
+
+  /**
+   * @brief Get the id of a controller, assigned on registration
+   * @param controllerName  Name of the controller
+   * @return id of the controller, invalidControllerId if it does not exist
+   */
+  ControllerId getControllerId(const std::string& controllerName) const;
+
+  /**
+   * @brief Get a copy of all available controller names, safe against concurrent registration
    * @return vector of the available controller names
    */
   std::vector<std::string> getAvailableControllerNames() const;
@@ -228,6 +586,24 @@ class ControllerManager {
    */
   State getControllerManagerState() const;
 
+  /**
+   * @brief Get the status of the manager without taking any lock (the tick and the transitions are never delayed)
+   * @return status as published on the last transition
+   */
+  Status getStatus() const;
+
+  /**
+   * @brief Adds a listener, notified after the notify functions of the manager
+   * @param listener  Listener (not owned, has to be removed before it is destroyed)
+   */
+  void addListener(Listener* listener);
+
+  /**
+   * @brief Removes a listener, it is not called anymore once this returns
+   * @param listener  Listener to remove
+   */
+  void removeListener(Listener* listener);
+
   /**
    * @brief Cleanup all controllers
    * @return true, if successful emergency stop and all controllers are cleaned up
@@ -248,6 +624,34 @@ class ControllerManager {
    */
   bool hasSharedModule(const std::string& moduleName) const;
 
+  /**
+   * @brief Get the timing statistics of updateController (requires ControllerManagerOptions::collectTimingStatistics)
+   * @return statistics of the updateController calls, can be called from any thread without locking the control loop
+   */
+  LatencyStatistics getUpdateControllerTimingStatistics() const;
+
+  /**
+   * @brief Get the timing report of a controller (requires ControllerManagerOptions::collectTimingStatistics)
+   * @param controllerName  Name of the controller, emergency controller or failproof controller
+   * @param report          Timing report of the controller
+   * @return true, iff a controller with this name exists
+   */
+  bool getControllerTimingReport(const std::string& controllerName, ControllerTimingReport& report) const;
+
+  /**
+   * @brief Get the allocations of the advances of a controller (requires AllocationTrackingOptions::enable)
+   * @param controllerName  Name of the controller, emergency controller or failproof controller
+   * @param statistics      Allocation statistics of the controller
+   * @return true, iff a controller with this name exists
+   */
+  bool getControllerAllocationStatistics(const std::string& controllerName, AllocationStatistics& statistics) const;
+
+  /**
+   * @brief Get the runtime statistics of the manager and all controllers
+   * @return counters of the control loop, read without locking it (can be called from any thread)
+   */
+  ControllerManagerStatistics getStatistics() const;
+
  protected:
   /**
    * @brief Prestop and stop controller
@@ -270,6 +674,26 @@ class ControllerManager {
    */
   bool stopController(roco::ControllerAdapterInterface* controller);
 
+  /**
+   * @brief Stops a controller on the stop executor (synchronously if there is none or its queue is full)
+   * @param controller   Pointer to the controller to stop
+   */
+  void stopControllerAsynchronously(roco::ControllerAdapterInterface* controller);
+
+  /**
+   * @brief Pre-stops and stops a controller that is flagged as being stopped, clears the flag
+   * @param controller   Pointer to the controller to stop
+   * @return true, if controller was stopped successfully
+   */
+  bool finishStoppingController(roco::ControllerAdapterInterface* controller);
+
+  /**
+   * @brief Blocks until a controller is not being stopped anymore (at most controllerStopTimeout)
+   * @param controller   Pointer to the controller
+   * @return true, iff the controller is not being stopped
+   */
+  bool waitUntilControllerStopped(roco::ControllerAdapterInterface* controller) const;
+
   /**
    * @brief notify others of the emergency stop (default: do nothing)
    * @param type     Type of the emergency stop
@@ -289,6 +713,29 @@ class ControllerManager {
    */
   virtual void notifyControllerManagerStateChanged(State /*state*/, bool /*clearedEmergencyStop*/) {}
 
+  /**
+   * @brief Posts the notifications of a transition. With asyncNotifications the notify functions and the listeners are called
+   *        on the notifier thread, the calling thread only enqueues and wakes it. If the queue is full, an emergency stop is kept
+   *        pending and delivered after the queued notifications, any other notification is dropped (see
+   *        getNumDroppedNotifications). Otherwise, or while the notifier thread is not running, they are called directly.
+   * @param type / newControllerName / state, clearedEmergencyStop  Arguments of the notify functions
+   *        (newControllerName must be owned by the manager, e.g. a name of the registries)
+   */
+  void postEmergencyStopNotification(EmergencyStopType type);
+  void postControllerChangedNotification(const std::string& newControllerName);
+  void postStateChangedNotification(State state, bool clearedEmergencyStop);
+
+  /**
+   * @brief Starts the notifier thread (if configured).
+   */
+  void startNotifier();
+
+  /**
+   * @brief Stops the notifier thread and delivers the pending notifications on the calling thread.
+   *        Subclasses overriding the notify functions have to call it (or cleanup) before they are destroyed.
+   */
+  void stopNotifier();
+
   /**
    * @brief Worker callback switching the controller
    * @param oldController   Pointer to the controller that is currently active
@@ -299,7 +746,242 @@ class ControllerManager {
   bool switchFromOldToNewController(roco::ControllerAdapterInterface* oldController, roco::ControllerAdapterInterface* newController,
                                     State previousState, std::promise<SwitchResponse>& response_promise);
 
+  /**
+   * @brief Make-before-break variant of switchFromOldToNewController. The old controller keeps advancing while the new one is swapped,
+   *        the cutover happens between two ticks and the old controller is stopped after the first tick of the new one.
+   * @param oldController   Pointer to the controller that is currently active
+   * @param newController   Pointer to the controller that shall be switched to
+   * @param previousState   To check if eStop was encountered
+   * @return true, if controller switching was successful
+   */
+  bool makeBeforeBreakSwitch(roco::ControllerAdapterInterface* oldController, roco::ControllerAdapterInterface* newController,
+                             State previousState, std::promise<SwitchResponse>& response_promise);
+
+  /**
+   * @brief Waits until updateController advanced a controller after the given tick (at most timeout)
+   * @param tick     Tick count to wait for to be exceeded
+   * @param timeout  Maximal waiting time [s]
+   * @return true, iff a tick happened
+   */
+  bool waitForTickAfter(std::uint64_t tick, double timeout) const;
+
+  /**
+   * @brief Waits until the condition holds, re-checks it after every tick (at most timeout)
+   * @param condition  Condition that a tick makes true
+   * @param timeout    Maximal waiting time [s]
+   * @return true, iff the condition holds
+   */
+  bool waitForTick(const std::function<bool()>& condition, double timeout) const;
+
+  /**
+   * @brief Gets the swap state of the running controller between two of its advances. The tick thread takes the swap state after
+   *        the next advance. Without a tick, the swap state is read with a unique lock on controllerMutex_ (excludes the locked
+   *        dispatch, the lock-free dispatch did not advance the controller for ten time steps).
+   * @param controller  Active controller
+   * @param swapState   Swap state of the controller
+   */
+  void getControllerSwapStateBetweenTicks(roco::ControllerAdapterInterface* controller, roco::ControllerSwapStateInterfacePtr& swapState);
+
+  /**
+   * @brief Serves a pending swap state request of getControllerSwapStateBetweenTicks on the tick thread
+   * @param controller  Controller that was just advanced
+   */
+  void takeRequestedSwapState(roco::ControllerAdapterInterface* controller);
+
+  /**
+   * @brief Publishes state_ and activeControllerPair_ to the lock-free dispatch record.
+   *        Has to be called with a unique lock on controllerMutex_ after every change of these members.
+   *        Does not wait for updateController to release the previous record, the caller waits for the grace
+   *        period with dispatchRecord_.waitForReaders() after releasing controllerMutex_.
+   * @return slot of the previous record
+   */
+  std::size_t publishDispatchRecord();
+
+  /**
+   * @brief Publishes state_, activeControllerPair_ and clearedEmergencyStop_ to the status read by getStatus.
+   *        Has to be called after every change of these members (publishDispatchRecord calls it).
+   */
+  void publishStatus();
+
+  /**
+   * @brief Creates a controller set with the monitors of its controllers
+   * @param controllerId       Id of the controller
+   * @param emgcyControllerId  Id of the emergency controller (can be invalidControllerId)
+   * @return controller set
+   */
+  ControllerSetPtr makeControllerSet(ControllerId controllerId, ControllerId emgcyControllerId);
+
+  /**
+   * @brief Appends a controller set to the pairs under the controller mutex (switchController reads them concurrently)
+   * @param controllerId       Id of the controller
+   * @param emgcyControllerId  Id of the emergency controller (can be invalidControllerId)
+   */
+  void addControllerSet(ControllerId controllerId, ControllerId emgcyControllerId);
+
+  /**
+   * @brief Adds the monitor for a controller and enables the timing of its phases (if configured)
+   * @param controller  Pointer to the controller
+   */
+  void setupControllerMonitor(roco::ControllerAdapterInterface* controller);
+
+  /**
+   * @brief Creates a lazily registered controller if it was not created yet (see lazyControllerCreation)
+   * @param controller  Pointer to the controller
+   * @return true, iff the controller is created
+   */
+  bool ensureControllerCreated(roco::ControllerAdapterInterface* controller);
+
  private:
+  /**
+   * Advances the controller that is active in the given state.
+   * @param record      State and active controllers
+   * @param escalation  Emergency stop requested by the deadline monitoring (NA if none)
+   * @return true, iff advancing was successful
+   */
+  bool advanceActiveController(const DispatchRecord& record, EmergencyStopType& escalation);
+
+  /**
+   * Emergency stops if advancing failed or the deadline monitoring requested it.
+   * @param successfullyAdvanced  Result of advancing the active controller
+   * @param escalation            Emergency stop requested by the deadline monitoring
+   * @return false, iff the emergency stop failed
+   */
+  bool handleAdvanceResult(bool successfullyAdvanced, EmergencyStopType escalation);
+
+  /**
+   * Applies the overrun policy.
+   * @param monitor         Monitor of the advanced controller
+   * @param controllerName  Name of the advanced controller
+   * @param duration        Duration of the advance [ns]
+   * @param isOverrun       True, iff the duration exceeded the budget
+   * @param canEscalate     False for the failproof controller
+   * @return Emergency stop type to escalate to (NA if none)
+   */
+  EmergencyStopType checkDeadline(ControllerMonitor& monitor, const std::string& controllerName, std::uint64_t duration, bool isOverrun,
+                                  bool canEscalate);
+
+  /**
+   * @return Budget of a controller according to the deadline options [ns]
+   */
+  std::uint64_t getControllerBudget(const std::string& controllerName) const;
+
+  /**
+   * Starts the heartbeat watchdog (if configured).
+   */
+  void startWatchdog();
+
+  /**
+   * Creates the tick driver for the current options.
+   */
+  void setupTickDriver();
+
+  /**
+   * Creates the stop executor (if configured).
+   */
+  void setupStopExecutor();
+
+  /**
+   * Creates and starts the thread advancing the emergency controller of the active pair in shadow (if configured).
+   */
+  void startHotStandby();
+
+  /**
+   * Stops the hot standby thread and restores the command of the emergency controller in shadow.
+   */
+  void stopHotStandby();
+
+  /**
+   * Hot standby tick, follows the active pair and advances its emergency controller in shadow.
+   * @return true
+   */
+  bool advanceHotStandby();
+
+  /**
+   * Hands over the command computed in shadow (requires a lock on hotStandbyMutex_).
+   * @param emgcyController  Emergency controller to take over
+   * @return true, iff the emergency controller was in hot standby and its command is live
+   */
+  bool takeOverFromHotStandby(roco::EmergencyControllerAdapterInterface* emgcyController);
+
+  /**
+   * Completes a hand over started by an emergency stop during a hot standby tick (requires a lock on hotStandbyMutex_).
+   * Takes the emergency controller over from hot standby or fast initializes it, the next tick then advances it.
+   */
+  void completeHotStandbyHandOver();
+
+  /**
+   * Shadow tick, advances the shadow controller once per tick of updateController.
+   * @return true
+   */
+  bool advanceShadow();
+
+  /**
+   * Starts the thread creating the lazily registered controllers ahead of their first switch (if configured).
+   */
+  void startCreateAhead();
+
+  /**
+   * Enqueues a notification for the notifier thread and wakes it. If the queue is full, an emergency stop sets the pending
+   * emergency stop, other notifications are dropped. Calls the notify functions directly if the notifier thread is not running.
+   * @param notification  Notification to post
+   */
+  void postNotification(const Notification& notification);
+
+  /**
+   * Calls the notify function and the listeners of a notification (requires a lock on listenerMutex_).
+   * The mutex is recursive, listeners may cause transitions.
+   * @param notification  Notification to deliver
+   */
+  void dispatchNotification(const Notification& notification);
+
+  /**
+   * Delivers the queued notifications, then the pending emergency stop (requires a lock on listenerMutex_).
+   */
+  void deliverNotifications();
+
+  /**
+   * Notifier thread, sleeps until a notification is posted and delivers it until stopNotifier is called.
+   */
+  void runNotifier();
+
+  /**
+   * Stops and joins the create ahead thread and logs the lazy creation report.
+   */
+  void stopCreateAhead();
+
+  /**
+   * Create ahead thread, creates the lazily registered controllers one by one at idle priority.
+   */
+  void createAhead();
+
+  /**
+   * Registers a controller whose creation is deferred to its first switch.
+   */
+  void registerUncreatedController(roco::ControllerAdapterInterface* controller);
+
+  /**
+   * Creates a lazily registered controller that was removed from the uncreated ones and updates the report.
+   * @param lock  Lock on creationMutex_, released while creating
+   * @return true, iff the controller was created
+   */
+  bool createLazily(roco::ControllerAdapterInterface* controller, std::unique_lock<std::mutex>& lock);
+
+  /**
+   * Failproof stops when updateController was not called within the heartbeat timeout.
+   * @return true
+   */
+  bool watchdogCallback(const any_worker::WorkerEvent& event);
+
+  /**
+   * @return Record of the current state and active controllers (requires a lock on controllerMutex_)
+   */
+  DispatchRecord makeDispatchRecord() const;
+
+  /**
+   * @return true, iff the advance of the controllers has to be timed
+   */
+  bool isMeasuringTimings() const { return options_.collectTimingStatistics || options_.deadlineOptions.enable; }
+
   /**
    * Checks if controller manager is initialized and failproof controller is setup.
    * @param message Additional message to use in printouts.
@@ -323,21 +1005,142 @@ class ControllerManager {
   //! Stopping controllers
   any_worker::WorkerManager workerManager_;
 
-  //! Unordered map of all available controllers (owned by the manager)
-  std::unordered_map<std::string, ControllerPtr> controllers_;
-  std::unordered_map<std::string, EmgcyControllerPtr> emergencyControllers_;
+  //! All available controllers indexed by their id (owned by the manager)
+  ControllerRegistry<ControllerPtr> controllers_;
+  ControllerRegistry<EmgcyControllerPtr> emergencyControllers_;
   std::unordered_map<std::string, roco::SharedModulePtr> sharedModules_;
 
-  //! Controller Pairs
-  std::unordered_map<std::string, ControllerSetPtr> controllerPairs_;
+  //! Controller Pairs indexed by the id of their controller (grown and read under controllerMutex_)
+  std::vector<ControllerSetPtr> controllerPairs_;
   ControllerSetPtr activeControllerPair_;
 
   //! Failproof Controller
   FailproofControllerPtr failproofController_;
 
+  //! Timing statistics of updateController and of its wait for updateControllerMutex_ and controllerMutex_
+  TimingStatistics updateControllerTiming_;
+  TimingStatistics updateControllerLockWait_;
+  //! Duration of the successful switches
+  TimingStatistics switchControllerTiming_;
+  //! Monitors of advanceController per controller name (added on registration)
+  std::unordered_map<std::string, std::unique_ptr<ControllerMonitor>> controllerMonitors_;
+  //! Mutex guarding the registries and the monitors against registration while they are read off the tick (never taken on the tick)
+  mutable std::mutex registrationMutex_;
+  //! Monitor of the failproof controller
+  ControllerMonitor failproofControllerMonitor_;
+
+  //! Time of the last updateController call [ns since epoch of TimingClock] (0 -> not armed)
+  std::atomic<std::int64_t> lastHeartbeat_;
+  //! True, iff the watchdog detected missed heartbeats (reset when heartbeats resume)
+  std::atomic_bool isHeartbeatMissed_;
+
+  //! Number of ticks that advanced a controller (incremented while the active controller is protected)
+  std::atomic<std::uint64_t> tickCount_;
+  //! Number of threads in waitForTick, the tick posts tickPosted_ only if there is one
+  mutable std::atomic<unsigned int> numTickWaiters_;
+  //! Posted after every tick while a thread waits for it
+  mutable Semaphore tickPosted_;
+
+  //! Progress of a swap state request served by the tick thread
+  enum class SwapStateRequest : int { NONE, REQUESTED, TAKING, TAKEN };
+  std::atomic<SwapStateRequest> swapStateRequest_;
+  //! Controller of the swap state request
+  std::atomic<roco::ControllerAdapterInterface*> swapStateController_;
+  //! Swap state taken by the tick thread
+  roco::ControllerSwapStateInterfacePtr swapState_;
+
+  //! Built-in loop calling updateController
+  std::unique_ptr<TickDriver> tickDriver_;
+  //! Stops controllers after emergency stops (nullptr if controllers are stopped synchronously)
+  std::unique_ptr<StopExecutor> stopExecutor_;
+
+  //! Lazily registered controllers that are not created yet, in registration order
+  std::vector<roco::ControllerAdapterInterface*> uncreatedControllers_;
+  //! Lazily registered controllers that are being created right now
+  std::unordered_set<roco::ControllerAdapterInterface*> controllersInCreation_;
+  //! Lazily registered controllers whose creation failed (retried on the next switch)
+  std::unordered_set<roco::ControllerAdapterInterface*> failedControllers_;
+  LazyCreationReport lazyCreationReport_;
+  //! Mutex protecting the lazy creation bookkeeping
+  mutable std::mutex creationMutex_;
+  //! Signals registrations, finished creations and stopping of the create ahead thread
+  std::condition_variable creationChanged_;
+  bool isStoppingCreateAhead_;
+  std::thread createAheadThread_;
+
+  //! Notifications waiting for the notifier thread
+  BoundedQueue<Notification> notifications_;
+  //! Listeners of the transitions
+  std::vector<Listener*> listeners_;
+  //! Mutex protecting the listeners and serializing the delivery of notifications
+  std::recursive_mutex listenerMutex_;
+  //! True, iff the notifier thread delivers the notifications
+  std::atomic_bool isNotifierRunning_;
+  //! Notifications dropped because the queue was full
+  std::atomic<std::uint64_t> numDroppedNotifications_;
+  //! Emergency stop that did not fit into the queue (sticky until the notifier delivers it, latest type wins)
+  std::atomic_bool isEmergencyStopPending_;
+  std::atomic<EmergencyStopType> pendingEmergencyStopType_;
+  //! Number of posts between checking isNotifierRunning_ and enqueuing, stopNotifier waits for them before its last delivery
+  std::atomic<unsigned int> numPostingNotifications_;
+  //! Posted on every enqueued notification and on stopping, wakes the notifier thread
+  Semaphore notificationPosted_;
+  std::atomic_bool isStoppingNotifier_;
+  std::thread notifierThread_;
+
+  //! Advances the emergency controller of the active pair in shadow (nullptr if not configured)
+  std::unique_ptr<TickDriver> hotStandbyDriver_;
+  //! Emergency controller in shadow and its hot standby interface (nullptr if none)
+  roco::EmergencyControllerAdapterInterface* standbyEmgcyController_;
+  HotStandbyInterface* standbyController_;
+  //! Mutex serializing the hot standby tick and the hand over in emergencyStop (which only tries to lock it)
+  std::mutex hotStandbyMutex_;
+  //! Set by emergencyStop until the new state is published, the hot standby thread then skips its ticks
+  std::atomic_bool isHotStandbySuspended_;
+  //! Set while the hot standby thread might use an emergency controller
+  std::atomic_bool isHotStandbyTicking_;
+  //! Emergency controller handed over during a hot standby tick, not advanced until the hot standby thread released it (nullptr if none)
+  std::atomic<roco::EmergencyControllerAdapterInterface*> hotStandbyHandOver_;
+  //! Start of the emergency stop of the pending hand over, until its latency is recorded (protected by emergencyStopMutex_)
+  TimingClock::time_point hotStandbyHandOverStart_;
+  //! Latency from entering an emergency stop to the first command of the emergency or failproof controller
+  TimingStatistics emergencyStopLatency_;
+
+  //! Advances the shadow controller (nullptr if none is attached)
+  std::unique_ptr<TickDriver> shadowDriver_;
+  //! Shadow controller and its shadow interface (nullptr if none is attached)
+  roco::ControllerAdapterInterface* shadowController_;
+  ShadowInterface* shadowInterface_;
+  //! Report of the shadow controller (advance_ and meanCommandDivergence_ are filled on request)
+  ShadowReport shadowReport_;
+  TimingStatistics shadowTiming_;
+  double shadowCommandDivergenceSum_;
+  //! Last tick of updateController the shadow controller was advanced in
+  std::uint64_t lastShadowTick_;
+  //! Mutex protecting the shadow controller and its report
+  mutable std::mutex shadowMutex_;
+  //! Mutex serializing attaching and detaching shadow controllers
+  std::mutex shadowAttachMutex_;
+  //! Controller in shadow the tick thread publishes its snapshots to (nullptr if none, published under shadowAttachMutex_)
+  RcuCell<ShadowInterface*> shadowSnapshotSource_;
+  //! Hint for the tick thread whether to read shadowSnapshotSource_ (relaxed, the source is authoritative)
+  std::atomic_bool isShadowAttached_;
+
   //! Mutex protecting state and active controller
   mutable boost::shared_mutex controllerMutex_;
 
+  //! State and active controller published for lock-free dispatch (written under unique lock of controllerMutex_)
+  RcuCell<DispatchRecord> dispatchRecord_;
+
+  //! Status published on transitions for lock-free monitoring
+  SeqLock<Status> status_;
+  //! Last published status (protected by statusMutex_)
+  Status publishedStatus_;
+  //! Mutex serializing the status writers
+  std::mutex statusMutex_;
+  //! Name of the failproof controller (outlives the controller, referred to by the status)
+  std::string failproofControllerName_;
+
   //! Mutex protecting emergency stop function call
   mutable std::mutex emergencyStopMutex_;
   //! Mutex protecting update Controller function call
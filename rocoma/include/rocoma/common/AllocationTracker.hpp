@@ -0,0 +1,124 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     AllocationTracker.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// STL
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace rocoma {
+
+//! Counts the heap allocations of the calling thread.
+/*! The counters are only incremented if the allocation interposer (src/common/AllocationInterposer.cpp) is linked into the
+ *  executable. It replaces malloc and friends. test_rocoma_allocations always links it, the benchmarks link it with
+ *  -DROCOMA_TRACK_ALLOCATIONS=ON.
+ */
+class AllocationTracker {
+ public:
+  //! @returns true iff the allocation interposer is linked
+  static bool isAvailable();
+
+  //! @returns number of allocations of the calling thread since its start
+  static std::uint64_t getThreadAllocations();
+
+  /*! While set, the next allocation of the calling thread aborts the process (to get the stack of the allocation).
+   * @param isAborting  flag indicating whether an allocation aborts
+   */
+  static void setAbortOnAllocation(bool isAborting);
+
+  //! Called by the interposer on every allocation (must not allocate)
+  static void recordAllocation();
+
+  //! Called by the interposer on startup
+  static void setAvailable();
+};
+
+//! Summary of the allocations of a controller (see AllocationTrackingOptions)
+struct AllocationStatistics {
+  //! Number of tracked advances
+  std::uint64_t numAdvances{0u};  // NOLINT(readability-identifier-naming)
+  //! Number of advances that allocated
+  std::uint64_t numAllocatingAdvances{0u};  // NOLINT(readability-identifier-naming)
+  //! Total number of allocations
+  std::uint64_t numAllocations{0u};  // NOLINT(readability-identifier-naming)
+  //! Maximal number of allocations of a single advance
+  std::uint64_t maxAllocationsPerAdvance{0u};  // NOLINT(readability-identifier-naming)
+};
+
+//! Allocation counts of the advances of a controller, any thread may read them concurrently
+class AllocationCounter {
+ public:
+  /*! Adds an advance
+   * @param numAllocations  allocations during the advance
+   */
+  void record(std::uint64_t numAllocations) {
+    numAdvances_.fetch_add(1u, std::memory_order_relaxed);
+    if (numAllocations == 0u) {
+      return;
+    }
+    numAllocatingAdvances_.fetch_add(1u, std::memory_order_relaxed);
+    numAllocations_.fetch_add(numAllocations, std::memory_order_relaxed);
+    std::uint64_t max = maxAllocationsPerAdvance_.load(std::memory_order_relaxed);
+    while (numAllocations > max && !maxAllocationsPerAdvance_.compare_exchange_weak(max, numAllocations, std::memory_order_relaxed)) {
+    }
+  }
+
+  //! @returns number of recorded advances
+  std::uint64_t getNumAdvances() const { return numAdvances_.load(std::memory_order_relaxed); }
+
+  //! @returns summary of the recorded advances
+  AllocationStatistics getStatistics() const {
+    AllocationStatistics statistics;
+    statistics.numAdvances = numAdvances_.load(std::memory_order_relaxed);
+    statistics.numAllocatingAdvances = numAllocatingAdvances_.load(std::memory_order_relaxed);
+    statistics.numAllocations = numAllocations_.load(std::memory_order_relaxed);
+    statistics.maxAllocationsPerAdvance = maxAllocationsPerAdvance_.load(std::memory_order_relaxed);
+    return statistics;
+  }
+
+ private:
+  std::atomic<std::uint64_t> numAdvances_{0u};
+  std::atomic<std::uint64_t> numAllocatingAdvances_{0u};
+  std::atomic<std::uint64_t> numAllocations_{0u};
+  std::atomic<std::uint64_t> maxAllocationsPerAdvance_{0u};
+};
+
+}  // namespace rocoma
@@ -0,0 +1,186 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     AsyncLogSink.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// rocoma
+#include "rocoma/common/BoundedQueue.hpp"
+
+// STL
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace rocoma {
+
+//! Pre-registered messages of the adapters and the manager (see AsyncLogSink)
+enum class LogMessageId : unsigned int {
+  // Controller lifecycle
+  ALREADY_CREATED = 0,
+  COULD_NOT_CREATE,
+  EXCEPTION_WHILE_CREATING,
+  UNKNOWN_EXCEPTION_WHILE_CREATING,
+  NOT_CREATED_ON_INITIALIZE,
+  COULD_NOT_INITIALIZE,
+  EXCEPTION_WHILE_INITIALIZING,
+  UNKNOWN_EXCEPTION_WHILE_INITIALIZING,
+  NOT_INITIALIZED_ON_ADVANCE,
+  COULD_NOT_ADVANCE,
+  EXCEPTION_WHILE_ADVANCING,
+  UNKNOWN_EXCEPTION_WHILE_ADVANCING,
+  BAD_STATE,
+  INVALID_COMMAND,
+  NOT_CREATED_ON_RESET,
+  COULD_NOT_RESET,
+  EXCEPTION_WHILE_RESETTING,
+  UNKNOWN_EXCEPTION_WHILE_RESETTING,
+  NOT_CREATED_ON_CLEANUP,
+  COULD_NOT_CLEAN_UP,
+  EXCEPTION_WHILE_CLEANING_UP,
+  UNKNOWN_EXCEPTION_WHILE_CLEANING_UP,
+  COULD_NOT_STOP,
+  EXCEPTION_WHILE_STOPPING,
+  UNKNOWN_EXCEPTION_WHILE_STOPPING,
+  COULD_NOT_PRE_STOP,
+  EXCEPTION_WHILE_PRE_STOPPING,
+  UNKNOWN_EXCEPTION_WHILE_PRE_STOPPING,
+  NOT_CREATED_ON_SWAP,
+  COULD_NOT_SWAP,
+  EXCEPTION_WHILE_SWAPPING,
+  UNKNOWN_EXCEPTION_WHILE_SWAPPING,
+  // Deadline monitoring
+  DEADLINE_OVERRUN,
+  // Emergency stop
+  EMERGENCY_STOP,
+  FAILPROOF_STOP,
+  EMERGENCY_CONTROLLER_IN_HOT_STANDBY_TICK,
+  SWITCHED_TO_FAILPROOF_CONTROLLER,
+  NUM_MESSAGES
+};
+
+//! Process-wide sink deferring the formatting of log messages to a background thread.
+/*! A message is captured as its id plus raw arguments (controller name and an optional text, both truncated) into a lock-free
+ *  ring buffer of fixed size. Capturing does not allocate, lock or notify. The background thread polls the ring, formats the
+ *  messages and forwards them to message_logger. If the ring is full the message is dropped and counted. While the sink is not
+ *  running, messages are formatted and forwarded on the calling thread.
+ *  The sink is process-wide, the adapters log without knowing their manager. Every manager with asyncLogging starts it on init and
+ *  stops it on destruction, the sink runs as long as one of them is alive and is shared by all of them.
+ */
+class AsyncLogSink {
+ public:
+  //! Number of messages the ring can hold (power of two)
+  static constexpr std::size_t capacity_ = 1024u;
+  //! Maximal lengths of the captured name and text, longer ones are truncated
+  static constexpr std::size_t maxNameLength_ = 63u;
+  static constexpr std::size_t maxTextLength_ = 191u;
+
+  //! @returns the sink used by the adapters and the manager
+  static AsyncLogSink& getInstance();
+
+  //! Destructor, stops the background thread
+  ~AsyncLogSink();
+
+  AsyncLogSink(const AsyncLogSink&) = delete;
+  AsyncLogSink& operator=(const AsyncLogSink&) = delete;
+
+  /*! Starts the background thread. Reference counted, every start must be matched by a stop.
+   * @param pollPeriod  period in which the background thread formats the captured messages [s]
+   */
+  void start(double pollPeriod = 0.01);
+
+  //! Stops the background thread after the last matching start, formats the remaining messages (including the ones of concurrent log calls)
+  void stop();
+
+  //! @returns true iff the background thread is running
+  bool isRunning() const { return isRunning_.load(std::memory_order_acquire); }
+
+  /*! Logs a message
+   * @param id    message
+   * @param name  controller name (if the message has one)
+   * @param text  text (if the message has one, e.g. the exception message)
+   */
+  void log(LogMessageId id, const std::string& name = std::string(), const char* text = nullptr);
+
+  //! Formats the captured messages on the calling thread
+  void flush();
+
+  //! @returns number of messages dropped because the ring was full
+  std::uint64_t getNumDroppedMessages() const { return numDroppedMessages_.load(std::memory_order_relaxed); }
+
+ private:
+  //! Captured message
+  struct Record {
+    LogMessageId id_{LogMessageId::NUM_MESSAGES};
+    char name_[maxNameLength_ + 1u];
+    char text_[maxTextLength_ + 1u];
+  };
+
+  AsyncLogSink();
+
+  //! Formats the captured messages and reports drops
+  void drain();
+
+  //! Body of the background thread
+  void run();
+
+  //! Formats and forwards a message to message_logger
+  static void forward(LogMessageId id, const char* name, const char* text);
+
+  BoundedQueue<Record> records_;
+  std::atomic<std::uint64_t> numDroppedMessages_;
+  std::uint64_t numReportedDrops_;
+  std::atomic_bool isRunning_;
+  //! Number of log calls between checking isRunning_ and pushing, stop waits for them before its last drain
+  std::atomic<unsigned int> numProducers_;
+  unsigned int numStarts_;
+  double pollPeriod_;
+  //! Serializes consumers (background thread and flush) and start/stop
+  std::mutex consumerMutex_;
+  std::mutex lifecycleMutex_;
+  std::mutex stopMutex_;
+  std::condition_variable stopRequested_;
+  bool isStopping_;
+  std::thread thread_;
+};
+
+}  // namespace rocoma
@@ -0,0 +1,142 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     BoundedQueue.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// STL
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace rocoma {
+
+//! Lock-free bounded multi-producer multi-consumer queue.
+/*! Every slot carries a sequence telling producers and consumers whose turn it is: a slot is free for position p if its sequence
+ *  is p and readable if it is p + 1. Pushing and popping never allocate, lock or wait for another thread, a full queue rejects
+ *  the value. The slots are allocated once on construction.
+ */
+template <typename Value_>
+class BoundedQueue {
+ public:
+  //! @param capacity  number of values the queue can hold (rounded up to a power of two)
+  explicit BoundedQueue(std::size_t capacity)
+      : capacity_(roundUpToPowerOfTwo(capacity)), slots_(new Slot[capacity_]), enqueuePosition_(0u), dequeuePosition_(0u) {
+    for (std::size_t i = 0u; i < capacity_; ++i) {
+      slots_[i].sequence_.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  BoundedQueue(const BoundedQueue&) = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  //! @returns false if the queue is full
+  bool tryPush(const Value_& value) {
+    std::size_t position = enqueuePosition_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      slot = &slots_[position & (capacity_ - 1u)];
+      const std::size_t sequence = slot->sequence_.load(std::memory_order_acquire);
+      if (sequence == position) {
+        if (enqueuePosition_.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (sequence < position) {
+        // Slot still holds the value of the previous lap
+        return false;
+      } else {
+        position = enqueuePosition_.load(std::memory_order_relaxed);
+      }
+    }
+    slot->value_ = value;
+    slot->sequence_.store(position + 1u, std::memory_order_release);
+    return true;
+  }
+
+  //! @returns false if the queue is empty
+  bool tryPop(Value_& value) {
+    std::size_t position = dequeuePosition_.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    while (true) {
+      slot = &slots_[position & (capacity_ - 1u)];
+      const std::size_t sequence = slot->sequence_.load(std::memory_order_acquire);
+      if (sequence == position + 1u) {
+        if (dequeuePosition_.compare_exchange_weak(position, position + 1u, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (sequence < position + 1u) {
+        // Slot was not written yet
+        return false;
+      } else {
+        position = dequeuePosition_.load(std::memory_order_relaxed);
+      }
+    }
+    value = slot->value_;
+    slot->sequence_.store(position + capacity_, std::memory_order_release);
+    return true;
+  }
+
+  //! @returns the number of values the queue can hold
+  std::size_t getCapacity() const { return capacity_; }
+
+ private:
+  struct Slot {
+    std::atomic<std::size_t> sequence_{0u};
+    Value_ value_{};
+  };
+
+  static std::size_t roundUpToPowerOfTwo(std::size_t capacity) {
+    std::size_t powerOfTwo = 1u;
+    while (powerOfTwo < capacity) {
+      powerOfTwo <<= 1u;
+    }
+    return powerOfTwo;
+  }
+
+  //! Padding keeping the positions on different cache lines, without over-aligning the queue (it is allocated with new, e.g. StopExecutor)
+  static constexpr std::size_t cacheLineSize_ = 64u;
+
+  const std::size_t capacity_;
+  std::unique_ptr<Slot[]> slots_;
+  char enqueuePadding_[cacheLineSize_];
+  std::atomic<std::size_t> enqueuePosition_;
+  char dequeuePadding_[cacheLineSize_ - sizeof(std::atomic<std::size_t>)];
+  std::atomic<std::size_t> dequeuePosition_;
+};
+
+}  // namespace rocoma
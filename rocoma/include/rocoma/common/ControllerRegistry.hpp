@@ -0,0 +1,140 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     ControllerRegistry.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// STL
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace rocoma {
+
+//! Dense handle of a registered controller, assigned in the order of registration
+using ControllerId = std::uint32_t;
+
+//! Id of no controller
+constexpr ControllerId invalidControllerId = std::numeric_limits<ControllerId>::max();
+
+//! Registry assigning dense ids to named values.
+/*! The values are stored contiguously and indexed by their id. Names are hashed only when an id is looked up by name, the
+ *  names keep their address for the lifetime of the registry and the sorted name table is maintained on registration.
+ *  Values are never removed. Registration is not thread-safe, lookups are safe as long as no value is added concurrently.
+ */
+template <typename Value_>
+class ControllerRegistry {
+ public:
+  using iterator = typename std::vector<Value_>::iterator;
+  using const_iterator = typename std::vector<Value_>::const_iterator;
+
+  /*! Adds a value
+   * @param name   unique name of the value
+   * @param value  value to add
+   * @returns the id of the value, invalidControllerId if the name already exists
+   */
+  ControllerId add(const std::string& name, Value_ value) {
+    const auto id = static_cast<ControllerId>(values_.size());
+    if (!ids_.insert(std::make_pair(name, id)).second) {
+      return invalidControllerId;
+    }
+    values_.push_back(std::move(value));
+    names_.push_back(name);
+    sortedNames_.insert(std::lower_bound(sortedNames_.begin(), sortedNames_.end(), name), name);
+    return id;
+  }
+
+  //! @returns the id of a name, invalidControllerId if it is not registered
+  ControllerId getId(const std::string& name) const {
+    auto id = ids_.find(name);
+    return id != ids_.end() ? id->second : invalidControllerId;
+  }
+
+  //! @returns true iff the name is registered
+  bool contains(const std::string& name) const { return ids_.find(name) != ids_.end(); }
+
+  //! @returns true iff the id is registered
+  bool contains(ControllerId id) const { return id < values_.size(); }
+
+  //! @returns the value of a registered id
+  Value_& operator[](ControllerId id) { return values_[id]; }
+  const Value_& operator[](ControllerId id) const { return values_[id]; }
+
+  //! @returns the value of a name, nullptr if it is not registered
+  Value_* find(const std::string& name) {
+    const ControllerId id = getId(name);
+    return id != invalidControllerId ? &values_[id] : nullptr;
+  }
+  const Value_* find(const std::string& name) const {
+    const ControllerId id = getId(name);
+    return id != invalidControllerId ? &values_[id] : nullptr;
+  }
+
+  //! @returns the name of a registered id
+  const std::string& getName(ControllerId id) const { return names_[id]; }
+
+  //! @returns the registered names in alphabetical order
+  const std::vector<std::string>& getSortedNames() const { return sortedNames_; }
+
+  //! @returns the number of registered values
+  std::size_t size() const { return values_.size(); }
+
+  //! Iterate the values in the order of their ids
+  iterator begin() { return values_.begin(); }
+  iterator end() { return values_.end(); }
+  const_iterator begin() const { return values_.begin(); }
+  const_iterator end() const { return values_.end(); }
+
+ private:
+  //! Values indexed by id
+  std::vector<Value_> values_;
+  //! Names indexed by id (deque keeps their address on registration)
+  std::deque<std::string> names_;
+  //! Ids by name
+  std::unordered_map<std::string, ControllerId> ids_;
+  //! Names in alphabetical order
+  std::vector<std::string> sortedNames_;
+};
+
+}  // namespace rocoma
@@ -0,0 +1,126 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     ParallelAdvancePool.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// STL
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rocoma {
+
+//! Options of the parallel advance pool
+struct ParallelAdvancePoolOptions {
+  //! Number of worker threads in addition to the calling thread (0 -> the calling thread runs all tasks)
+  unsigned int numThreads{0u};  // NOLINT(readability-identifier-naming)
+  //! Cpu every worker thread is pinned to (missing or negative -> no pinning)
+  std::vector<int> cpuAffinities{};  // NOLINT(readability-identifier-naming)
+  //! SCHED_FIFO priority of the worker threads (0 -> inherit the scheduling policy and priority of the thread calling run)
+  int priority{0};  // NOLINT(readability-identifier-naming)
+};
+
+//! Runs a batch of tasks on a fixed set of worker threads and the calling thread, and waits for all of them (barrier).
+/*! All threads claim the next task of the batch from a shared atomic counter, such that long tasks do not delay the others. There are
+ *  no per-thread queues and no work stealing. Running a batch does not allocate.
+ */
+class ParallelAdvancePool {
+ public:
+  //! Task, called with the index of the task within the batch
+  using Task = std::function<void(std::size_t)>;
+
+  /*! Constructor, starts the worker threads
+   * @param options  Number, pinning and priority of the worker threads
+   */
+  explicit ParallelAdvancePool(const ParallelAdvancePoolOptions& options);
+
+  //! Destructor, joins the worker threads
+  ~ParallelAdvancePool();
+
+  ParallelAdvancePool(const ParallelAdvancePool&) = delete;
+  ParallelAdvancePool& operator=(const ParallelAdvancePool&) = delete;
+
+  /*! Runs task(0), ..., task(numTasks - 1) and returns when all of them are done. Must not be called concurrently.
+   * @param numTasks  Number of tasks
+   * @param task      Task (must stay valid until run returns)
+   */
+  void run(std::size_t numTasks, const Task& task);
+
+  //! @returns the number of worker threads
+  unsigned int getNumThreads() const { return static_cast<unsigned int>(threads_.size()); }
+
+ private:
+  //! Worker thread loop
+  void work(unsigned int workerIndex);
+
+  //! Runs tasks of the current batch until none is left
+  void runTasks();
+
+  //! Sets priority and affinity of a worker thread
+  void setupThread(unsigned int workerIndex) const;
+
+  //! Applies the scheduling policy and priority of the thread calling run to a worker thread (if it changed)
+  void inheritScheduling(int& policy, int& priority) const;
+
+ private:
+  ParallelAdvancePoolOptions options_;
+  //! Protects the batch and wakes up the workers
+  std::mutex mutex_;
+  std::condition_variable batchStarted_;
+  std::condition_variable batchFinished_;
+  //! Current batch (written under mutex_ before the workers are woken up)
+  const Task* task_;
+  std::size_t numTasks_;
+  std::atomic<std::size_t> nextTask_;
+  //! Incremented for every batch
+  std::uint64_t batch_;
+  //! Scheduling policy and priority of the thread calling run, inherited by the workers (if no priority is set)
+  int callerPolicy_;
+  int callerPriority_;
+  //! Number of workers that did not finish the current batch
+  unsigned int numBusyWorkers_;
+  bool isStopping_;
+  std::vector<std::thread> threads_;
+};
+
+}  // namespace rocoma
@@ -0,0 +1,157 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     RcuCell.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// STL
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <thread>
+
+namespace rocoma {
+
+//! Read-copy-update cell holding a small record that is read without locks.
+/*! Readers pin the currently published slot for the duration of a ReadGuard. A writer fills a slot that is neither
+ *  published nor pinned, publishes it and then waits until all readers of the previous slot have left (grace period).
+ *  After publish() returns, no reader can still observe the previous record. Readers never block; writers must be
+ *  serialized externally and may wait for at most one reader critical section. Writers that serialize with a lock
+ *  the readers might wait for use exchange() under the lock and waitForReaders() after releasing it.
+ */
+template <typename Record_, std::size_t NumSlots_ = 3>
+class RcuCell {
+  static_assert(NumSlots_ >= 2, "[RcuCell]: At least two slots are required.");
+
+ public:
+  //! Pins the record that was published at construction time
+  class ReadGuard {
+   public:
+    explicit ReadGuard(const RcuCell& cell) : cell_(&cell), slot_(cell.pin()) {}
+    ReadGuard(ReadGuard&& other) noexcept : cell_(other.cell_), slot_(other.slot_) { other.cell_ = nullptr; }
+    ReadGuard(const ReadGuard&) = delete;
+    ReadGuard& operator=(const ReadGuard&) = delete;
+    ReadGuard& operator=(ReadGuard&&) = delete;
+    ~ReadGuard() { release(); }
+
+    //! Releases the pinned record early, the guard must not be dereferenced afterwards
+    void release() {
+      if (cell_ != nullptr) {
+        cell_->readers_[slot_].fetch_sub(1);
+        cell_ = nullptr;
+      }
+    }
+
+    const Record_& operator*() const { return cell_->slots_[slot_]; }
+    const Record_* operator->() const { return &cell_->slots_[slot_]; }
+
+   private:
+    const RcuCell* cell_;
+    std::size_t slot_;
+  };
+
+  //! Constructor
+  explicit RcuCell(const Record_& initial = Record_()) : current_(0) {
+    slots_.fill(initial);
+    for (auto& readers : readers_) {
+      readers.store(0);
+    }
+  }
+
+  //! Pin and access the currently published record
+  ReadGuard read() const { return ReadGuard(*this); }
+
+  /*! Publish a new record and wait until the previous one is retired.
+   * @param record  record to publish
+   */
+  void publish(const Record_& record) { waitForReaders(exchange(record)); }
+
+  /*! Publish a new record without waiting for the readers of the previous one.
+   * @param record  record to publish
+   * @returns slot of the previous record, pass it to waitForReaders() before relying on its retirement
+   */
+  std::size_t exchange(const Record_& record) {
+    const std::size_t previous = current_.load();
+    std::size_t next = (previous + 1) % NumSlots_;
+    while (next == previous || readers_[next].load() != 0) {
+      next = (next + 1) % NumSlots_;
+      if (next == previous) {
+        std::this_thread::yield();
+      }
+    }
+    slots_[next] = record;
+    current_.store(next);
+    return previous;
+  }
+
+  /*! Grace period: wait until the readers that pinned a retired slot finished their critical section.
+   *  Readers that pin the slot again after it was republished are not waited for.
+   * @param slot  slot returned by exchange(), noSlot_ is ignored
+   */
+  void waitForReaders(std::size_t slot) const {
+    if (slot == noSlot_) {
+      return;
+    }
+    while (readers_[slot].load() != 0 && current_.load() != slot) {
+      std::this_thread::yield();
+    }
+  }
+
+  //! Slot value that does not refer to a retired record
+  static constexpr std::size_t noSlot_ = NumSlots_;
+
+ private:
+  std::size_t pin() const {
+    while (true) {
+      const std::size_t slot = current_.load();
+      readers_[slot].fetch_add(1);
+      // Validate that the slot was not retired in between
+      if (current_.load() == slot) {
+        return slot;
+      }
+      readers_[slot].fetch_sub(1);
+    }
+  }
+
+ private:
+  std::array<Record_, NumSlots_> slots_;
+  mutable std::array<std::atomic<std::size_t>, NumSlots_> readers_;
+  std::atomic<std::size_t> current_;
+};
+
+}  // namespace rocoma
@@ -0,0 +1,95 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     Semaphore.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// POSIX
+#include <semaphore.h>
+#include <time.h>
+
+// STL
+#include <cerrno>
+#include <cstdint>
+
+namespace rocoma {
+
+//! Counting semaphore waking a waiting thread from a real-time thread.
+/*! post() neither locks nor allocates, it only makes a system call if a thread is blocked in wait. Unlike a condition variable,
+ *  a post before the wait is not lost, the waiter returns immediately and re-checks its condition.
+ */
+class Semaphore {
+ public:
+  Semaphore() { sem_init(&semaphore_, 0, 0u); }
+  ~Semaphore() { sem_destroy(&semaphore_); }
+
+  Semaphore(const Semaphore&) = delete;
+  Semaphore& operator=(const Semaphore&) = delete;
+
+  //! Increments the count and wakes one waiter
+  void post() { sem_post(&semaphore_); }
+
+  //! Waits until the count is positive and decrements it
+  void wait() {
+    while (sem_wait(&semaphore_) != 0 && errno == EINTR) {
+    }
+  }
+
+  /*! Waits until the count is positive and decrements it
+   * @param timeout  maximal waiting time [s]
+   * @return false, iff the timeout expired
+   */
+  bool waitFor(double timeout) {
+    timespec deadline{};
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    const std::int64_t nanoseconds = deadline.tv_nsec + static_cast<std::int64_t>(timeout * 1.0e9);
+    deadline.tv_sec += static_cast<time_t>(nanoseconds / 1000000000);
+    deadline.tv_nsec = static_cast<long>(nanoseconds % 1000000000);  // NOLINT(google-runtime-int)
+    while (sem_timedwait(&semaphore_, &deadline) != 0) {
+      if (errno != EINTR) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+ private:
+  sem_t semaphore_;
+};
+
+}  // namespace rocoma
@@ -0,0 +1,116 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     SeqLock.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// STL
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace rocoma {
+
+//! Sequence lock holding a small trivially copyable record.
+/*! The writer makes the sequence odd, copies the record and makes the sequence even again. Readers copy the record and retry if
+ *  the sequence was odd or changed meanwhile. Readers never write shared memory and never delay the writer, they only retry while
+ *  a store is in progress. The record is copied word by word through relaxed atomics, so concurrent reads are not data races.
+ *  Writers must be serialized externally.
+ */
+template <typename Record_>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<Record_>::value, "[SeqLock]: The record must be trivially copyable.");
+
+ public:
+  SeqLock() : SeqLock(Record_()) {}
+
+  explicit SeqLock(const Record_& record) : sequence_(0u) { storeWords(record); }
+
+  SeqLock(const SeqLock&) = delete;
+  SeqLock& operator=(const SeqLock&) = delete;
+
+  //! Publishes a record (writers must be serialized)
+  void store(const Record_& record) {
+    const std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+    sequence_.store(sequence + 1u, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    storeWords(record);
+    sequence_.store(sequence + 2u, std::memory_order_release);
+  }
+
+  //! @returns a consistent copy of the last published record
+  Record_ load() const {
+    std::array<std::uint64_t, numWords_> words;
+    std::uint64_t before = 0u;
+    std::uint64_t after = 0u;
+    do {
+      before = sequence_.load(std::memory_order_acquire);
+      for (std::size_t i = 0u; i < numWords_; ++i) {
+        words[i] = words_[i].load(std::memory_order_relaxed);
+      }
+      std::atomic_thread_fence(std::memory_order_acquire);
+      after = sequence_.load(std::memory_order_relaxed);
+    } while ((before & 1u) != 0u || before != after);
+
+    Record_ record;
+    std::memcpy(static_cast<void*>(&record), words.data(), sizeof(Record_));
+    return record;
+  }
+
+  //! @returns the number of stores (each store increments the sequence by two)
+  std::uint64_t getNumStores() const { return sequence_.load(std::memory_order_acquire) / 2u; }
+
+ private:
+  static constexpr std::size_t numWords_ = (sizeof(Record_) + sizeof(std::uint64_t) - 1u) / sizeof(std::uint64_t);
+
+  void storeWords(const Record_& record) {
+    std::array<std::uint64_t, numWords_> words{};
+    std::memcpy(words.data(), &record, sizeof(Record_));
+    for (std::size_t i = 0u; i < numWords_; ++i) {
+      words_[i].store(words[i], std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<std::uint64_t> sequence_;
+  std::array<std::atomic<std::uint64_t>, numWords_> words_;
+};
+
+}  // namespace rocoma
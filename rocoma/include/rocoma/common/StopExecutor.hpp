@@ -0,0 +1,116 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     StopExecutor.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// rocoma
+#include "rocoma/common/BoundedQueue.hpp"
+#include "rocoma/common/Semaphore.hpp"
+
+// roco
+#include <roco/controllers/controllers.hpp>
+
+// STL
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace rocoma {
+
+//! Stops controllers on a dedicated thread (default scheduling policy), such that the caller does not wait for preStop and stop.
+/*! Requests are stored in a fixed-capacity lock-free queue and the executor is woken by a semaphore. Submitting neither allocates nor
+ *  locks, it can be called from the tick thread.
+ */
+class StopExecutor {
+ public:
+  //! Callback stopping a controller
+  using StopCallback = std::function<void(roco::ControllerAdapterInterface*)>;
+
+  //! Maximal number of pending requests
+  static constexpr std::size_t capacity_ = 16u;
+
+  /*! Constructor, starts the executor thread
+   * @param callback  Callback stopping a controller
+   */
+  explicit StopExecutor(StopCallback callback);
+
+  //! Destructor, executes the pending requests and joins the executor thread (blocks until all callbacks returned)
+  ~StopExecutor();
+
+  StopExecutor(const StopExecutor&) = delete;
+  StopExecutor& operator=(const StopExecutor&) = delete;
+
+  /*! Queues a controller to be stopped
+   * @param controller  controller to stop
+   * @return false, iff the queue is full
+   */
+  bool submit(roco::ControllerAdapterInterface* controller);
+
+  /*! Waits until all submitted requests are completed
+   * @param timeout  maximal waiting time [s]
+   * @return true, iff all requests are completed
+   */
+  bool waitUntilIdle(double timeout);
+
+  //! @return number of submitted requests that are not completed
+  std::uint64_t getPendingCount() const { return submitted_.load() - completed_.load(); }
+
+ private:
+  //! Executor thread
+  void execute();
+
+ private:
+  StopCallback callback_;
+  BoundedQueue<roco::ControllerAdapterInterface*> queue_;
+  Semaphore requestAvailable_;
+  std::atomic_bool isShuttingDown_;
+  //! Number of submit calls between the shutdown check and the push, the executor drains the queue after they left
+  std::atomic<unsigned int> numSubmitting_;
+  std::atomic<std::uint64_t> submitted_;
+  std::atomic<std::uint64_t> completed_;
+  //! Only used to wait for completed requests (waitUntilIdle)
+  std::mutex mutex_;
+  std::condition_variable requestCompleted_;
+  std::thread thread_;
+};
+
+}  // namespace rocoma
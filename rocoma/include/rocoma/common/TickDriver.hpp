@@ -0,0 +1,150 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     TickDriver.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// rocoma
+#include "rocoma/common/TimingStatistics.hpp"
+
+// STL
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace rocoma {
+
+//! Options of the real-time tick driver
+struct TickDriverOptions {
+  //! Default constructor
+  TickDriverOptions() = default;
+
+  //! Copy constructor
+  TickDriverOptions(const TickDriverOptions& other) = default;
+
+  //! SCHED_FIFO priority of the tick thread (0 -> keep the scheduling policy of the thread)
+  int priority{0};  // NOLINT(readability-identifier-naming)
+  //! Cpu the tick thread is pinned to (negative -> no pinning)
+  int cpuAffinity{-1};  // NOLINT(readability-identifier-naming)
+  //! Sleep until this duration before the deadline and busy wait for the rest [s] (non-positive -> no busy wait)
+  double busyWaitTail{0.0};  // NOLINT(readability-identifier-naming)
+};
+
+//! Statistics of the tick driver
+struct TickDriverStatistics {
+  //! Number of ticks
+  std::uint64_t ticks{0};  // NOLINT(readability-identifier-naming)
+  //! Number of deadlines that passed while a tick was running (these ticks are skipped)
+  std::uint64_t missedDeadlines{0};  // NOLINT(readability-identifier-naming)
+  //! Number of ticks the callback returned false
+  std::uint64_t failedTicks{0};  // NOLINT(readability-identifier-naming)
+  //! Delay between the deadline and the start of the tick
+  LatencyStatistics wakeupLatency{};  // NOLINT(readability-identifier-naming)
+};
+
+//! Calls a callback periodically using absolute deadlines on the monotonic clock (no drift).
+/*! A tick that overruns the next deadline skips the missed deadlines instead of catching up.
+ */
+class TickDriver {
+ public:
+  //! Callback executed every tick
+  using TickCallback = std::function<bool()>;
+
+  /*! Constructor
+   * @param callback  Callback executed every tick
+   * @param timeStep  Period of the ticks [s]
+   * @param options   Scheduling options
+   */
+  TickDriver(TickCallback callback, double timeStep, const TickDriverOptions& options);
+
+  //! Destructor, stops the tick thread
+  ~TickDriver();
+
+  TickDriver(const TickDriver&) = delete;
+  TickDriver& operator=(const TickDriver&) = delete;
+
+  /*! Runs the loop in a new thread.
+   * @return false, iff the driver is already running
+   */
+  bool start();
+
+  /*! Runs the loop in the calling thread until stop() is called.
+   * @return false, iff the driver is already running
+   */
+  bool run();
+
+  /*! Stops the loop after the current tick and waits for it to end (does not wait if called from within a tick).
+   */
+  void stop();
+
+  //! @return true, iff the loop is running
+  bool isRunning() const { return isRunning_.load(); }
+
+  //! @return statistics of all ticks since construction (can be called from any thread)
+  TickDriverStatistics getStatistics() const;
+
+ private:
+  //! Applies priority and affinity to the calling thread
+  void setupThread() const;
+
+  //! Tick loop
+  void loop();
+
+ private:
+  TickCallback callback_;
+  std::int64_t period_;
+  TickDriverOptions options_;
+
+  std::atomic_bool isRunning_;
+  std::atomic_bool stopRequested_;
+  //! Protects the transitions of isRunning_ and stopRequested_
+  std::mutex stateMutex_;
+  //! Thread started by start()
+  std::thread thread_;
+  //! Thread executing the loop (default id if not running)
+  std::atomic<std::thread::id> loopThreadId_;
+
+  std::atomic<std::uint64_t> ticks_;
+  std::atomic<std::uint64_t> missedDeadlines_;
+  std::atomic<std::uint64_t> failedTicks_;
+  TimingStatistics wakeupLatency_;
+};
+
+}  // namespace rocoma
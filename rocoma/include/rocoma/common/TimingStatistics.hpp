@@ -0,0 +1,263 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     TimingStatistics.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// STL
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+namespace rocoma {
+
+//! Monotonic clock used for all timing measurements
+using TimingClock = std::chrono::steady_clock;
+
+//! Converts a duration in seconds to nanoseconds
+inline std::uint64_t toNanoseconds(double seconds) {
+  return seconds > 0.0 ? static_cast<std::uint64_t>(seconds * 1e9) : 0u;
+}
+
+//! Nanoseconds elapsed since start
+inline std::uint64_t nanosecondsSince(const TimingClock::time_point& start) {
+  return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(TimingClock::now() - start).count());
+}
+
+//! Summary of a latency distribution (all durations in seconds)
+struct LatencyStatistics {
+  //! Number of samples
+  std::uint64_t count{0};  // NOLINT(readability-identifier-naming)
+  //! Number of samples that exceeded the budget
+  std::uint64_t overruns{0};  // NOLINT(readability-identifier-naming)
+  //! Duration of the last sample
+  double last{0.0};  // NOLINT(readability-identifier-naming)
+  //! Mean duration
+  double mean{0.0};  // NOLINT(readability-identifier-naming)
+  //! Maximal duration
+  double max{0.0};  // NOLINT(readability-identifier-naming)
+  //! Percentiles
+  double p50{0.0};   // NOLINT(readability-identifier-naming)
+  double p90{0.0};   // NOLINT(readability-identifier-naming)
+  double p99{0.0};   // NOLINT(readability-identifier-naming)
+  double p999{0.0};  // NOLINT(readability-identifier-naming)
+};
+
+//! Allocation-free latency histogram with log-linear buckets (8 sub-buckets per power of two, i.e. <12.5% relative error).
+/*! Recording uses relaxed atomics only, any thread may read the histogram concurrently.
+ */
+class LatencyHistogram {
+ public:
+  //! Number of sub-buckets per power of two
+  static constexpr unsigned int subBucketBits_ = 3u;
+  static constexpr std::uint64_t subBucketCount_ = 1u << subBucketBits_;
+  //! Values from this power of two on (~18 minutes in nanoseconds) are clamped to the last bucket
+  static constexpr unsigned int maxExponent_ = 40u;
+  static constexpr std::size_t numBuckets_ = (maxExponent_ - subBucketBits_ + 1u) * subBucketCount_;
+
+  LatencyHistogram() { reset(); }
+
+  /*! Adds a sample
+   * @param nanoseconds duration of the sample
+   */
+  void record(std::uint64_t nanoseconds) {
+    buckets_[bucketIndex(nanoseconds)].fetch_add(1u, std::memory_order_relaxed);
+    count_.fetch_add(1u, std::memory_order_relaxed);
+    sum_.fetch_add(nanoseconds, std::memory_order_relaxed);
+    std::uint64_t max = max_.load(std::memory_order_relaxed);
+    while (nanoseconds > max && !max_.compare_exchange_weak(max, nanoseconds, std::memory_order_relaxed)) {
+    }
+  }
+
+  //! Removes all samples (not synchronized with concurrent recording)
+  void reset() {
+    for (auto& bucket : buckets_) {
+      bucket.store(0u, std::memory_order_relaxed);
+    }
+    count_.store(0u, std::memory_order_relaxed);
+    sum_.store(0u, std::memory_order_relaxed);
+    max_.store(0u, std::memory_order_relaxed);
+  }
+
+  //! @returns number of samples
+  std::uint64_t getCount() const { return count_.load(std::memory_order_relaxed); }
+
+  //! @returns maximal sample [ns]
+  std::uint64_t getMax() const { return max_.load(std::memory_order_relaxed); }
+
+  //! @returns mean of all samples [ns]
+  double getMean() const {
+    const std::uint64_t count = getCount();
+    return count == 0u ? 0.0 : static_cast<double>(sum_.load(std::memory_order_relaxed)) / static_cast<double>(count);
+  }
+
+  /*! Upper bound of the bucket containing the given percentile
+   * @param percentile  percentile in [0, 1]
+   * @returns percentile [ns]
+   */
+  double getPercentile(double percentile) const {
+    std::array<std::uint64_t, numBuckets_> buckets;
+    std::uint64_t total = 0u;
+    for (std::size_t i = 0u; i < numBuckets_; ++i) {
+      buckets[i] = buckets_[i].load(std::memory_order_relaxed);
+      total += buckets[i];
+    }
+    if (total == 0u) {
+      return 0.0;
+    }
+
+    const auto target = static_cast<std::uint64_t>(std::ceil(std::min(std::max(percentile, 0.0), 1.0) * static_cast<double>(total)));
+    std::uint64_t cumulative = 0u;
+    for (std::size_t i = 0u; i < numBuckets_; ++i) {
+      cumulative += buckets[i];
+      if (cumulative >= target && cumulative > 0u) {
+        return static_cast<double>(std::min(bucketUpperBound(i), getMax()));
+      }
+    }
+    return static_cast<double>(getMax());
+  }
+
+  //! @returns index of the bucket containing value
+  static std::size_t bucketIndex(std::uint64_t value) {
+    if (value < subBucketCount_) {
+      return static_cast<std::size_t>(value);
+    }
+    const auto exponent = static_cast<unsigned int>(63 - __builtin_clzll(value));
+    if (exponent >= maxExponent_) {
+      return numBuckets_ - 1u;
+    }
+    const std::uint64_t subBucket = (value >> (exponent - subBucketBits_)) & (subBucketCount_ - 1u);
+    return static_cast<std::size_t>((exponent - subBucketBits_ + 1u) * subBucketCount_ + subBucket);
+  }
+
+  //! @returns smallest value that is larger than all values of the bucket
+  static std::uint64_t bucketUpperBound(std::size_t index) {
+    if (index < subBucketCount_) {
+      return index + 1u;
+    }
+    const auto exponent = static_cast<unsigned int>(index / subBucketCount_ + subBucketBits_ - 1u);
+    const std::uint64_t subBucket = index % subBucketCount_;
+    return (subBucketCount_ + subBucket + 1u) << (exponent - subBucketBits_);
+  }
+
+ private:
+  std::array<std::atomic<std::uint64_t>, numBuckets_> buckets_;
+  std::atomic<std::uint64_t> count_;
+  std::atomic<std::uint64_t> sum_;
+  std::atomic<std::uint64_t> max_;
+};
+
+//! Latency histogram with an overrun counter
+class TimingStatistics {
+ public:
+  TimingStatistics() : histogram_(), overruns_(0u), last_(0u) {}
+
+  /*! Adds a sample
+   * @param nanoseconds     duration of the sample
+   * @param budgetNanoseconds  budget of the sample (0 -> no budget)
+   * @returns true iff the sample exceeded the budget
+   */
+  bool record(std::uint64_t nanoseconds, std::uint64_t budgetNanoseconds) {
+    histogram_.record(nanoseconds);
+    last_.store(nanoseconds, std::memory_order_relaxed);
+    if (budgetNanoseconds != 0u && nanoseconds > budgetNanoseconds) {
+      overruns_.fetch_add(1u, std::memory_order_relaxed);
+      return true;
+    }
+    return false;
+  }
+
+  //! Removes all samples (not synchronized with concurrent recording)
+  void reset() {
+    histogram_.reset();
+    overruns_.store(0u, std::memory_order_relaxed);
+    last_.store(0u, std::memory_order_relaxed);
+  }
+
+  //! @returns the underlying histogram
+  const LatencyHistogram& getHistogram() const { return histogram_; }
+
+  //! @returns number of overruns
+  std::uint64_t getOverruns() const { return overruns_.load(std::memory_order_relaxed); }
+
+  //! @returns summary of the recorded samples
+  LatencyStatistics getStatistics() const {
+    LatencyStatistics statistics;
+    statistics.count = histogram_.getCount();
+    statistics.overruns = getOverruns();
+    statistics.last = static_cast<double>(last_.load(std::memory_order_relaxed)) * 1e-9;
+    statistics.mean = histogram_.getMean() * 1e-9;
+    statistics.max = static_cast<double>(histogram_.getMax()) * 1e-9;
+    statistics.p50 = histogram_.getPercentile(0.5) * 1e-9;
+    statistics.p90 = histogram_.getPercentile(0.9) * 1e-9;
+    statistics.p99 = histogram_.getPercentile(0.99) * 1e-9;
+    statistics.p999 = histogram_.getPercentile(0.999) * 1e-9;
+    return statistics;
+  }
+
+ private:
+  LatencyHistogram histogram_;
+  std::atomic<std::uint64_t> overruns_;
+  std::atomic<std::uint64_t> last_;
+};
+
+//! Records the lifetime of the object into timing statistics (does nothing if statistics is nullptr)
+class ScopedTiming {
+ public:
+  ScopedTiming(TimingStatistics* statistics, std::uint64_t budgetNanoseconds)
+      : statistics_(statistics),
+        budgetNanoseconds_(budgetNanoseconds),
+        start_(statistics != nullptr ? TimingClock::now() : TimingClock::time_point()) {}
+  ScopedTiming(const ScopedTiming&) = delete;
+  ScopedTiming& operator=(const ScopedTiming&) = delete;
+  ~ScopedTiming() {
+    if (statistics_ != nullptr) {
+      statistics_->record(nanosecondsSince(start_), budgetNanoseconds_);
+    }
+  }
+
+ private:
+  TimingStatistics* statistics_;
+  std::uint64_t budgetNanoseconds_;
+  TimingClock::time_point start_;
+};
+
+}  // namespace rocoma
@@ -0,0 +1,121 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     TripleBuffer.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// STL
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace rocoma {
+
+//! Wait-free single producer / single consumer hand-off of the latest value.
+/*! The writer fills the back buffer and swaps it with the middle buffer, the reader swaps the middle buffer with the front buffer if it
+ *  holds a newer value. Neither side ever waits, the reader always sees the latest completely written value.
+ *  Several writers (or readers) have to be serialized externally.
+ */
+template <typename Value_>
+class TripleBuffer {
+ public:
+  using Value = Value_;
+
+  /*! Constructor
+   * @param value  Initial value of all buffers
+   */
+  explicit TripleBuffer(const Value& value = Value()) : buffers_{{value, value, value}}, back_(0u), middle_(1u), front_(2u) {}
+
+  TripleBuffer(const TripleBuffer&) = delete;
+  TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+  //! @returns buffer the writer fills before calling publish()
+  Value& getWriteBuffer() { return buffers_[back_]; }
+
+  //! Makes the write buffer available to the reader
+  void publish() { back_ = middle_.exchange(back_ | newValueBit_, std::memory_order_acq_rel) & indexMask_; }
+
+  /*! Copies a value into the write buffer and publishes it
+   * @param value  value to publish
+   */
+  void write(const Value& value) {
+    getWriteBuffer() = value;
+    publish();
+  }
+
+  //! @returns true, iff a value was published since the last update()
+  bool hasNewValue() const { return (middle_.load(std::memory_order_relaxed) & newValueBit_) != 0u; }
+
+  /*! Fetches the latest published value into the read buffer
+   * @returns true, iff the read buffer changed
+   */
+  bool update() {
+    if (!hasNewValue()) {
+      return false;
+    }
+    front_ = middle_.exchange(front_, std::memory_order_acq_rel) & indexMask_;
+    return true;
+  }
+
+  //! @returns buffer holding the value fetched by the last update()
+  const Value& getReadBuffer() const { return buffers_[front_]; }
+
+  /*! Copies the latest published value
+   * @param value  latest value
+   * @returns true, iff the value was published since the last read
+   */
+  bool read(Value& value) {
+    const bool isNew = update();
+    value = getReadBuffer();
+    return isNew;
+  }
+
+ private:
+  static constexpr std::uint8_t indexMask_ = 0x3u;
+  static constexpr std::uint8_t newValueBit_ = 0x4u;
+
+  std::array<Value, 3> buffers_;
+  //! Owned by the writer
+  std::uint8_t back_;
+  //! Shared index with new value flag
+  std::atomic<std::uint8_t> middle_;
+  //! Owned by the reader
+  std::uint8_t front_;
+};
+
+}  // namespace rocoma
@@ -47,7 +47,13 @@
 #include "roco/model/StateInterface.hpp"
 
 // Rocoma
+#include "rocoma/common/AsyncLogSink.hpp"
+#include "rocoma/common/TimingStatistics.hpp"
+#include "rocoma/common/TripleBuffer.hpp"
+#include "rocoma/controllers/CommandDivergence.hpp"
+#include "rocoma/controllers/ControllerAdapterExtensionInterface.hpp"
 #include "rocoma/controllers/ControllerExtensionImplementation.hpp"
+#include "rocoma/controllers/ShadowInterface.hpp"
 
 // Boost
 #include <boost/thread.hpp>
@@ -55,14 +61,19 @@
 // STL
 #include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
 #include <exception>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 
 namespace rocoma {
 
 template <typename Controller_, typename State_, typename Command_>
 class ControllerAdapter : virtual public roco::ControllerAdapterInterface,
+                          public ControllerAdapterExtensionInterface,
+                          public ShadowInterface,
                           public ControllerExtensionImplementation<Controller_, State_, Command_> {
  public:
   //! Convenience typedefs
@@ -159,7 +170,15 @@ class ControllerAdapter : virtual public roco::ControllerAdapterInterface,
   /*! This function sets whether the controller is being stopped
    * @param isBeeingStopped flag indicating whether controller is being stopped
    */
-  void setIsBeingStopped(bool isBeingStopped) override { isBeingStopped_ = isBeingStopped; }
+  void setIsBeingStopped(bool isBeingStopped) override {
+    {
+      std::lock_guard<std::mutex> lock(stopMutex_);
+      isBeingStopped_ = isBeingStopped;
+    }
+    if (!isBeingStopped) {
+      stopCompleted_.notify_all();
+    }
+  }
 
   /*! This function indicates whether the controller is running (meaning it is the currently advanced controller)
    * @returns true iff controller is being stopped
@@ -171,6 +190,68 @@ class ControllerAdapter : virtual public roco::ControllerAdapterInterface,
    */
   void setIsRunning(bool isRunning) override { this->isRunning_ = isRunning; }
 
+  //! Implementation of the rocoma extensions (rocoma::ControllerAdapterExtensionInterface)
+  /*! Enables timing of the advance phases.
+   * @param isCollecting  flag indicating whether timings should be collected
+   */
+  void setIsCollectingTimings(bool isCollecting) override { isCollectingTimings_ = isCollecting; }
+
+  /*! Indicates whether the advance phases are timed.
+   * @returns true iff timings are collected
+   */
+  bool isCollectingTimings() const override { return isCollectingTimings_; }
+
+  /*! Timings of the advance phases, can be read from any thread.
+   * @returns timings
+   */
+  const ControllerTimings& getControllerTimings() const override { return timings_; }
+
+  /*! Blocks until the controller is not being stopped anymore.
+   * @param timeout  maximal waiting time [s]
+   * @returns true iff the controller is not being stopped
+   */
+  bool waitUntilStopped(double timeout) const override {
+    std::unique_lock<std::mutex> lock(stopMutex_);
+    return stopCompleted_.wait_for(lock, std::chrono::duration<double>(timeout), [this]() { return !isBeingStopped_; });
+  }
+
+  //! Implementation of the shadow execution (rocoma::ShadowInterface)
+  /*! Redirects state and command to private copies and initializes the controller against them.
+   * @param dt  time step [s]
+   * @returns true iff the controller is in shadow
+   */
+  bool enterShadow(double dt) override;
+
+  /*! Copies the state of the current tick into a snapshot for the shadow thread (called on the tick thread).
+   */
+  void publishShadowSnapshot() override { publishShadowSnapshot(IsShadowable()); }
+
+  /*! Copies the state of the latest snapshot into the private state, advances the controller and compares its command to a copy of
+   *  the live command.
+   * @param dt  time step [s]
+   * @returns true if successful
+   */
+  bool advanceInShadow(double dt) override;
+
+  /*! Stops the controller and restores state and command.
+   */
+  void leaveShadow() override;
+
+  /*! Indicates whether the controller is in shadow.
+   * @returns true iff state and command are redirected
+   */
+  bool isInShadow() const override { return isInShadow_; }
+
+  /*! Indicates whether a divergence is defined for the command type (see CommandDivergence).
+   * @returns true iff getCommandDivergence() is meaningful
+   */
+  bool hasCommandDivergence() const override { return CommandDivergence<Command_>::isDefined_; }
+
+  /*! Divergence of the private command from the command after the last advance in shadow.
+   * @returns divergence
+   */
+  double getCommandDivergence() const override { return commandDivergence_; }
+
  protected:
   /*! Update the robot state. (Check for limits)
    * @param dt          time step [s]
@@ -185,8 +266,64 @@ class ControllerAdapter : virtual public roco::ControllerAdapterInterface,
    */
   bool updateCommand(double dt);
 
+ protected:
+  /*! Statistics to record a phase into (nullptr if timings are not collected)
+   * @param statistics  statistics of the phase
+   * @returns pointer to statistics or nullptr
+   */
+  TimingStatistics* timingsOf(TimingStatistics& statistics) {
+    return isCollectingTimings_.load(std::memory_order_relaxed) ? &statistics : nullptr;
+  }
+
+  //! Shadow execution requires copying state and command
+  using IsShadowable = std::integral_constant<bool, std::is_copy_constructible<State_>::value && std::is_copy_assignable<State_>::value &&
+                                                        std::is_copy_constructible<Command_>::value &&
+                                                        std::is_copy_assignable<Command_>::value>;
+
+  /*! Creates the private state and command as copies of the state and command.
+   * @returns true if successful
+   */
+  bool makeShadowContainers(std::true_type /*isShadowable*/);
+  bool makeShadowContainers(std::false_type /*isShadowable*/) { return false; }
+
+  //! Copies the live state into the write buffer of the snapshots and publishes it
+  void publishShadowSnapshot(std::true_type /*isShadowable*/);
+  void publishShadowSnapshot(std::false_type /*isShadowable*/) {}
+
+  //! Copies the state of the latest snapshot into the private state
+  void takeStateSnapshot(std::true_type /*isShadowable*/);
+  void takeStateSnapshot(std::false_type /*isShadowable*/) {}
+
+  //! Copies the live command (on the shadow thread) and computes the divergence of the private command from it
+  void compareToLiveCommand(std::true_type /*isShadowable*/);
+  void compareToLiveCommand(std::false_type /*isShadowable*/) {}
+
  protected:
   std::atomic_bool isBeingStopped_{false};
+  //! Signals the end of stopping
+  mutable std::mutex stopMutex_;
+  mutable std::condition_variable stopCompleted_;
+  //! Indicates if the advance phases are timed
+  std::atomic_bool isCollectingTimings_{false};
+  //! Timings of the advance phases
+  ControllerTimings timings_;
+  //! Private state and command of the shadow execution
+  std::shared_ptr<State_> shadowState_;
+  std::shared_ptr<Command_> shadowCommand_;
+  //! State of a tick, published by the tick thread and read by the shadow thread
+  std::unique_ptr<TripleBuffer<State_>> shadowStateSnapshots_;
+  //! Copy of the live command taken by the shadow thread to compute the divergence
+  std::shared_ptr<Command_> liveCommandCopy_;
+  //! State and command exchanged with the private ones while in shadow
+  std::shared_ptr<State_> liveState_;
+  std::shared_ptr<boost::shared_mutex> liveStateMutex_;
+  std::shared_ptr<Command_> liveCommand_;
+  std::shared_ptr<boost::shared_mutex> liveCommandMutex_;
+  std::shared_ptr<typename Base::CommandChannel> liveCommandChannel_;
+  //! Indicates if state and command are redirected
+  std::atomic_bool isInShadow_{false};
+  //! Divergence of the private command after the last advance in shadow
+  double commandDivergence_{0.0};
 };
 
 }  // namespace rocoma
@@ -50,7 +50,7 @@ namespace rocoma {
 template <typename Controller_, typename State_, typename Command_>
 bool ControllerAdapter<Controller_, State_, Command_>::createController(double dt) {
   if (this->isCreated()) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Has already been created!");
+    AsyncLogSink::getInstance().log(LogMessageId::ALREADY_CREATED, this->getControllerName());
     return true;
   }
 
@@ -61,7 +61,7 @@ bool ControllerAdapter<Controller_, State_, Command_>::createController(double d
     // Create controller
     if (!this->create(dt)) {
       this->isCreated_ = false;
-      MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Could not be created!");
+      AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_CREATE, this->getControllerName());
       return false;
     }
 
@@ -72,12 +72,12 @@ bool ControllerAdapter<Controller_, State_, Command_>::createController(double d
 #ifdef NDEBUG
   catch (std::exception& e) {
     //! return false (let manager handle this)
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while creating: " << e.what());
+    AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_CREATING, this->getControllerName(), e.what());
     this->isCreated_ = false;
     return false;
   } catch (...) {
     //! return false (let manager handle this)
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while creating!");
+    AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_CREATING, this->getControllerName());
     this->isCreated_ = false;
     return false;
   }
@@ -90,7 +90,7 @@ template <typename Controller_, typename State_, typename Command_>
 bool ControllerAdapter<Controller_, State_, Command_>::initializeController(double dt) {
   // Check if the controller was created.
   if (!this->isCreated()) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Not created on initialize!");
+    AsyncLogSink::getInstance().log(LogMessageId::NOT_CREATED_ON_INITIALIZE, this->getControllerName());
     return false;
   }
 
@@ -111,7 +111,7 @@ bool ControllerAdapter<Controller_, State_, Command_>::initializeController(doub
 
     // Initialize controller
     if (!this->initialize(dt)) {
-      MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Could not be initialized!");
+      AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_INITIALIZE, this->getControllerName());
       return false;
     }
 
@@ -125,11 +125,11 @@ bool ControllerAdapter<Controller_, State_, Command_>::initializeController(doub
   }
 #ifdef NDEBUG
   catch (std::exception& e) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while initializing:\n" << e.what());
+    AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_INITIALIZING, this->getControllerName(), e.what());
     this->isInitialized_ = false;
     return false;
   } catch (...) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while initializing!\n");
+    AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_INITIALIZING, this->getControllerName());
     this->isInitialized_ = false;
     return false;
   }
@@ -145,7 +145,7 @@ template <typename Controller_, typename State_, typename Command_>
 bool ControllerAdapter<Controller_, State_, Command_>::advanceController(double dt) {
   // Check if controller is initialized
   if (!this->isInitialized()) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Not initialized on advance!");
+    AsyncLogSink::getInstance().log(LogMessageId::NOT_INITIALIZED_ON_ADVANCE, this->getControllerName());
     return false;
   }
 
@@ -153,28 +153,39 @@ bool ControllerAdapter<Controller_, State_, Command_>::advanceController(double
   try
 #endif
   {
+    const std::uint64_t budget = toNanoseconds(dt);
+
     // Advance controller
-    if (!this->updateState(dt)) {
-      return false;
+    {
+      ScopedTiming timing(timingsOf(timings_.updateState_), budget);
+      if (!this->updateState(dt)) {
+        return false;
+      }
     }
 
-    if (!this->advance(dt)) {
-      MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Could not advance!");
-      return false;
+    {
+      ScopedTiming timing(timingsOf(timings_.advance_), budget);
+      if (!this->advance(dt)) {
+        AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_ADVANCE, this->getControllerName());
+        return false;
+      }
     }
 
     // Update commands
-    if (!this->updateCommand(dt)) {
-      return false;
+    {
+      ScopedTiming timing(timingsOf(timings_.updateCommand_), budget);
+      if (!this->updateCommand(dt)) {
+        return false;
+      }
     }
 
   }
 #ifdef NDEBUG
   catch (std::exception& e) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while advancing: " << e.what());
+    AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_ADVANCING, this->getControllerName(), e.what());
     return false;
   } catch (...) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while advancing! ");
+    AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_ADVANCING, this->getControllerName());
     return false;
   }
 #endif
@@ -185,7 +196,7 @@ template <typename Controller_, typename State_, typename Command_>
 bool ControllerAdapter<Controller_, State_, Command_>::resetController(double dt) {
   // Check if controller was created
   if (!this->isCreated()) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Has not been created!");
+    AsyncLogSink::getInstance().log(LogMessageId::NOT_CREATED_ON_RESET, this->getControllerName());
     return false;
   }
 
@@ -205,7 +216,7 @@ bool ControllerAdapter<Controller_, State_, Command_>::resetController(double dt
 
     // Reset controller
     if (!this->reset(dt)) {
-      MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Could not reset controller!");
+      AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_RESET, this->getControllerName());
       return false;
     }
 
@@ -217,10 +228,10 @@ bool ControllerAdapter<Controller_, State_, Command_>::resetController(double dt
   }
 #ifdef NDEBUG
   catch (std::exception& e) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while resetting: " << e.what());
+    AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_RESETTING, this->getControllerName(), e.what());
     return false;
   } catch (...) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while resetting!");
+    AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_RESETTING, this->getControllerName());
     return false;
   }
 #endif
@@ -236,7 +247,7 @@ bool ControllerAdapter<Controller_, State_, Command_>::cleanupController() {
 
   // Check if controller was created
   if (!this->isCreated()) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Was not created!");
+    AsyncLogSink::getInstance().log(LogMessageId::NOT_CREATED_ON_CLEANUP, this->getControllerName());
     return false;
   }
 
@@ -246,17 +257,17 @@ bool ControllerAdapter<Controller_, State_, Command_>::cleanupController() {
 #endif
   {
     if (!this->cleanup()) {
-      MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Could not clean up!");
+      AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_CLEAN_UP, this->getControllerName());
       return false;
     }
 
   }
 #ifdef NDEBUG
   catch (std::exception& e) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while cleaning up: " << e.what());
+    AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_CLEANING_UP, this->getControllerName(), e.what());
     return false;
   } catch (...) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while cleaning up!");
+    AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_CLEANING_UP, this->getControllerName());
     return false;
   }
 #endif
@@ -276,16 +287,16 @@ bool ControllerAdapter<Controller_, State_, Command_>::stopController() {
 #endif
   {
     if (!this->stop()) {
-      MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Could not be stopped!");
+      AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_STOP, this->getControllerName());
       return false;
     }
   }
 #ifdef NDEBUG
   catch (std::exception& e) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while stopping: " << e.what());
+    AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_STOPPING, this->getControllerName(), e.what());
     return false;
   } catch (...) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while stopping!");
+    AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_STOPPING, this->getControllerName());
     return false;
   }
 #endif
@@ -300,16 +311,16 @@ bool ControllerAdapter<Controller_, State_, Command_>::preStopController() {
 #endif
   {
     if (!this->preStop()) {
-      MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Could not prepare to stop controller!");
+      AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_PRE_STOP, this->getControllerName());
       return false;
     }
   }
 #ifdef NDEBUG
   catch (std::exception& e) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while pre-stopping: " << e.what());
+    AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_PRE_STOPPING, this->getControllerName(), e.what());
     return false;
   } catch (...) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while pre-stopping! ");
+    AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_PRE_STOPPING, this->getControllerName());
     return false;
   }
 #endif
@@ -321,7 +332,7 @@ template <typename Controller_, typename State_, typename Command_>
 bool ControllerAdapter<Controller_, State_, Command_>::swapController(double dt, const roco::ControllerSwapStateInterfacePtr& swapState) {
   // Check if the controller was created.
   if (!this->isCreated()) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Not created on swap!");
+    AsyncLogSink::getInstance().log(LogMessageId::NOT_CREATED_ON_SWAP, this->getControllerName());
     return false;
   }
 
@@ -339,7 +350,7 @@ bool ControllerAdapter<Controller_, State_, Command_>::swapController(double dt,
 
     // Swap controller
     if (!this->swap(dt, swapState)) {
-      MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Could not be swapped!");
+      AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_SWAP, this->getControllerName());
       return false;
     }
 
@@ -353,11 +364,11 @@ bool ControllerAdapter<Controller_, State_, Command_>::swapController(double dt,
   }
 #ifdef NDEBUG
   catch (std::exception& e) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while swapping:\n" << e.what());
+    AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_SWAPPING, this->getControllerName(), e.what());
     this->isInitialized_ = false;
     return false;
   } catch (...) {
-    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Exception caught while swapping!\n");
+    AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_SWAPPING, this->getControllerName());
     this->isInitialized_ = false;
     return false;
   }
@@ -378,6 +389,120 @@ bool ControllerAdapter<Controller_, State_, Command_>::addControllerSharedModule
   return this->addSharedModule(module);
 }
 
+template <typename Controller_, typename State_, typename Command_>
+bool ControllerAdapter<Controller_, State_, Command_>::enterShadow(double dt) {
+  if (isInShadow_) {
+    return true;
+  }
+  if (!makeShadowContainers(IsShadowable())) {
+    MELO_WARN_STREAM("[Rocoma][" << this->getControllerName() << "] Can not run in shadow, state or command is not copyable!");
+    return false;
+  }
+
+  // Exchange the containers, the live ones are kept to take snapshots and compare commands
+  liveState_ = shadowState_;
+  liveStateMutex_ = std::make_shared<boost::shared_mutex>();
+  this->exchangeState(liveState_, liveStateMutex_);
+  liveCommand_ = shadowCommand_;
+  liveCommandMutex_ = std::make_shared<boost::shared_mutex>();
+  liveCommandChannel_.reset();
+  this->exchangeCommand(liveCommand_, liveCommandMutex_, liveCommandChannel_);
+  isInShadow_ = true;
+  commandDivergence_ = 0.0;
+
+  if (!initializeController(dt)) {
+    leaveShadow();
+    return false;
+  }
+  MELO_INFO_STREAM("[Rocoma][" << this->getControllerName() << "] Running in shadow.");
+  return true;
+}
+
+template <typename Controller_, typename State_, typename Command_>
+bool ControllerAdapter<Controller_, State_, Command_>::advanceInShadow(double dt) {
+  if (!isInShadow_) {
+    return false;
+  }
+
+  // Only the snapshot of the latest tick is read, the live state and command are not locked
+  takeStateSnapshot(IsShadowable());
+  if (!advanceController(dt)) {
+    return false;
+  }
+
+  // The tick thread only publishes the state, the live command is copied here
+  compareToLiveCommand(IsShadowable());
+  return true;
+}
+
+template <typename Controller_, typename State_, typename Command_>
+void ControllerAdapter<Controller_, State_, Command_>::leaveShadow() {
+  if (!isInShadow_) {
+    return;
+  }
+
+  // Stop against the private containers, stopping might write the command
+  if (this->isInitialized()) {
+    preStopController();
+    stopController();
+  }
+
+  this->exchangeState(liveState_, liveStateMutex_);
+  this->exchangeCommand(liveCommand_, liveCommandMutex_, liveCommandChannel_);
+  isInShadow_ = false;
+  liveState_.reset();
+  liveStateMutex_.reset();
+  liveCommand_.reset();
+  liveCommandMutex_.reset();
+  liveCommandChannel_.reset();
+  shadowState_.reset();
+  shadowCommand_.reset();
+  shadowStateSnapshots_.reset();
+  liveCommandCopy_.reset();
+  MELO_INFO_STREAM("[Rocoma][" << this->getControllerName() << "] Stopped running in shadow.");
+}
+
+template <typename Controller_, typename State_, typename Command_>
+bool ControllerAdapter<Controller_, State_, Command_>::makeShadowContainers(std::true_type /*isShadowable*/) {
+  {
+    boost::shared_lock<boost::shared_mutex> lock(this->getStateMutex());
+    shadowState_ = std::make_shared<State_>(this->getState());
+  }
+  {
+    boost::shared_lock<boost::shared_mutex> lock(this->getCommandMutex());
+    shadowCommand_ = std::make_shared<Command_>(this->getCommand());
+  }
+  shadowStateSnapshots_.reset(new TripleBuffer<State_>(*shadowState_));
+  liveCommandCopy_ = std::make_shared<Command_>(*shadowCommand_);
+  return true;
+}
+
+template <typename Controller_, typename State_, typename Command_>
+void ControllerAdapter<Controller_, State_, Command_>::publishShadowSnapshot(std::true_type /*isShadowable*/) {
+  {
+    boost::shared_lock<boost::shared_mutex> lock(*liveStateMutex_);
+    shadowStateSnapshots_->getWriteBuffer() = *liveState_;
+  }
+  shadowStateSnapshots_->publish();
+}
+
+template <typename Controller_, typename State_, typename Command_>
+void ControllerAdapter<Controller_, State_, Command_>::takeStateSnapshot(std::true_type /*isShadowable*/) {
+  shadowStateSnapshots_->update();
+  boost::unique_lock<boost::shared_mutex> lockShadow(this->getStateMutex());
+  *shadowState_ = shadowStateSnapshots_->getReadBuffer();
+}
+
+template <typename Controller_, typename State_, typename Command_>
+void ControllerAdapter<Controller_, State_, Command_>::compareToLiveCommand(std::true_type /*isShadowable*/) {
+  {
+    boost::shared_lock<boost::shared_mutex> lockLive(*liveCommandMutex_);
+    *liveCommandCopy_ = *liveCommand_;
+  }
+  boost::shared_lock<boost::shared_mutex> lockShadow(this->getCommandMutex());
+  commandDivergence_ = CommandDivergence<Command_>::compute(*shadowCommand_, *liveCommandCopy_);
+}
+
 template <typename Controller_, typename State_, typename Command_>
 bool ControllerAdapter<Controller_, State_, Command_>::updateState(double /*dt*/, bool checkState) {
   this->time_.setNow();
@@ -385,7 +510,7 @@ bool ControllerAdapter<Controller_, State_, Command_>::updateState(double /*dt*/
   if (checkState && this->isCheckingState_) {
     boost::shared_lock<boost::shared_mutex> lock(this->getStateMutex());
     if (!this->getState().checkState()) {
-      MELO_ERROR_STREAM("[Rocoma][" << this->getControllerName() << "] Bad state!");
+      AsyncLogSink::getInstance().log(LogMessageId::BAD_STATE, this->getControllerName());
       return false;
     }
   }
@@ -394,12 +519,13 @@ bool ControllerAdapter<Controller_, State_, Command_>::updateState(double /*dt*/
 
 template <typename Controller_, typename State_, typename Command_>
 bool ControllerAdapter<Controller_, State_, Command_>::updateCommand(double /*dt*/) {
-  if (this->isCheckingCommand_) {
+  if (this->isCheckingCommand_ || this->hasCommandChannel()) {
     boost::unique_lock<boost::shared_mutex> lock(this->getCommandMutex());
-    if (!this->getCommand().limitCommand()) {
-      MELO_ERROR_STREAM("[Rocoma][" << this->getControllerName() << "] The command is invalid!");
+    if (this->isCheckingCommand_ && !this->getCommand().limitCommand()) {
+      AsyncLogSink::getInstance().log(LogMessageId::INVALID_COMMAND, this->getControllerName());
       return false;
     }
+    this->publishCommand();
   }
 
   return true;
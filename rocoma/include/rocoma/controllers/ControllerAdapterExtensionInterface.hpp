@@ -0,0 +1,85 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     ControllerAdapterExtensionInterface.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// Rocoma
+#include "rocoma/common/TimingStatistics.hpp"
+
+namespace rocoma {
+
+//! Timings of the phases of ControllerAdapter::advanceController
+struct ControllerTimings {
+  //! Checking the state
+  TimingStatistics updateState_;
+  //! Adaptee advance
+  TimingStatistics advance_;
+  //! Limiting the command
+  TimingStatistics updateCommand_;
+};
+
+//! Rocoma specific extensions of roco::ControllerAdapterInterface (the manager accesses them via dynamic_cast)
+class ControllerAdapterExtensionInterface {
+ public:
+  //! Default destructor
+  virtual ~ControllerAdapterExtensionInterface() = default;
+
+  /*! Enables timing of the advance phases.
+   * @param isCollecting  flag indicating whether timings should be collected
+   */
+  virtual void setIsCollectingTimings(bool isCollecting) = 0;
+
+  /*! Indicates whether the advance phases are timed.
+   * @returns true iff timings are collected
+   */
+  virtual bool isCollectingTimings() const = 0;
+
+  /*! Timings of the advance phases, can be read from any thread.
+   * @returns timings
+   */
+  virtual const ControllerTimings& getControllerTimings() const = 0;
+
+  /*! Blocks until the controller is not being stopped anymore.
+   * @param timeout  maximal waiting time [s]
+   * @returns true iff the controller is not being stopped
+   */
+  virtual bool waitUntilStopped(double timeout) const = 0;
+};
+
+}  // namespace rocoma
@@ -41,6 +41,9 @@
 
 #pragma once
 
+// Rocoma
+#include "rocoma/controllers/CommandChannelInterface.hpp"
+
 // Boost
 #include <boost/thread.hpp>
 
@@ -54,7 +57,7 @@ namespace rocoma {
  *
  */
 template <typename Controller_, typename State_, typename Command_>
-class ControllerImplementation : public Controller_ {
+class ControllerImplementation : public Controller_, public CommandChannelInterface<Command_> {
   //! Check if State_ template parameter implements the roco::StateInterface
   static_assert(std::is_base_of<roco::StateInterface, State_>::value,
                 "[ControllerImplementation]: The State class does not implement roco::StateInterface!");
@@ -67,6 +70,7 @@ class ControllerImplementation : public Controller_ {
   using Controller = Controller_;
   using State = State_;
   using Command = Command_;
+  using CommandChannel = typename CommandChannelInterface<Command_>::CommandChannel;
 
  public:
   //! Default constructor
@@ -101,6 +105,42 @@ class ControllerImplementation : public Controller_ {
   //! @returns a mutex to protect access to the command.
   boost::shared_mutex& getCommandMutex() override { return *mutexCommand_; }
 
+  /*! Set the command channel, the command is published into it on every advance.
+   * @param commandChannel  command channel (nullptr -> mutex protected command container only)
+   */
+  void setCommandChannel(std::shared_ptr<CommandChannel> commandChannel) override { commandChannel_ = commandChannel; }
+
+ protected:
+  //! @returns true, iff a command channel is set
+  bool hasCommandChannel() const { return commandChannel_ != nullptr; }
+
+  /*! Copies the command into the command channel (if set).
+   *  The caller has to hold the unique lock of the command mutex, it serializes the writers of the channel.
+   */
+  void publishCommand() {
+    if (commandChannel_ != nullptr) {
+      commandChannel_->write(*command_);
+    }
+  }
+
+  /*! Exchanges the state container and its mutex with the given ones.
+   *  Used to advance the controller against a state snapshot, must not be called concurrently with advance.
+   */
+  void exchangeState(std::shared_ptr<State>& state, std::shared_ptr<boost::shared_mutex>& mutexState) {
+    state_.swap(state);
+    mutexState_.swap(mutexState);
+  }
+
+  /*! Exchanges the command container, its mutex and the command channel with the given ones.
+   *  Used to advance the controller against a scratch command, must not be called concurrently with advance.
+   */
+  void exchangeCommand(std::shared_ptr<Command>& command, std::shared_ptr<boost::shared_mutex>& mutexCommand,
+                       std::shared_ptr<CommandChannel>& commandChannel) {
+    command_.swap(command);
+    mutexCommand_.swap(mutexCommand);
+    commandChannel_.swap(commandChannel);
+  }
+
  private:
   //! Robot state container
   std::shared_ptr<State> state_;
@@ -110,6 +150,8 @@ class ControllerImplementation : public Controller_ {
   std::shared_ptr<Command> command_;
   //! Actuator command container mutex
   std::shared_ptr<boost::shared_mutex> mutexCommand_;
+  //! Wait-free hand-off of the command to the hardware
+  std::shared_ptr<CommandChannel> commandChannel_;
 };
 
 }  // namespace rocoma
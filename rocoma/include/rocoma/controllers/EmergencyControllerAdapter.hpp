@@ -48,11 +48,13 @@
 
 // Rocoma
 #include "rocoma/controllers/ControllerAdapter.hpp"
+#include "rocoma/controllers/HotStandbyInterface.hpp"
 
 // Message logger
 #include <message_logger/message_logger.hpp>
 
 // STL
+#include <atomic>
 #include <cassert>
 #include <memory>
 #include <type_traits>
@@ -61,7 +63,8 @@ namespace rocoma {
 
 template <typename Controller_, typename State_, typename Command_>
 class EmergencyControllerAdapter : virtual public roco::EmergencyControllerAdapterInterface,
-                                   public ControllerAdapter<Controller_, State_, Command_> {
+                                   public ControllerAdapter<Controller_, State_, Command_>,
+                                   public HotStandbyInterface {
   //! Check if Controller_ template parameter inherits from roco::EmergencyControllerAdapteeInterface
   static_assert(std::is_base_of<roco::EmergencyControllerAdapteeInterface, Controller_>::value,
                 "[EmergencyControllerAdapter]: The Controller class does not implement the EmergencyControllerAdatpeeInterface.");
@@ -133,6 +136,174 @@ class EmergencyControllerAdapter : virtual public roco::EmergencyControllerAdapt
 
     return true;
   }
+
+  //! Implementation of the hot standby (rocoma::HotStandbyInterface)
+  /*! Redirects the command to a scratch container and fast initializes the controller against it.
+   * @param dt  time step [s]
+   * @returns true iff the controller is in hot standby
+   */
+  bool enterHotStandby(double dt) override {
+    if (isInHotStandby_) {
+      return true;
+    }
+    if (!makeStandbyCommand(IsCommandCopyable())) {
+      MELO_WARN_STREAM("[Rocoma][" << this->getName() << "] Can not be kept in hot standby, the command is not copyable!");
+      return false;
+    }
+
+    this->exchangeCommand(standbyCommand_, standbyCommandMutex_, standbyCommandChannel_);
+    handOverCommand_ = standbyCommand_;
+    handOverCommandMutex_ = standbyCommandMutex_;
+    handOverCommandChannel_ = standbyCommandChannel_;
+    isInHotStandby_ = true;
+    isStandbyCommandValid_ = initializeControllerFast(dt);
+    // Advanced in shadow, not by the manager
+    this->isRunning_ = false;
+    if (!isStandbyCommandValid_) {
+      restoreCommand();
+      return false;
+    }
+    writeHandOverCommand(IsCommandCopyable());
+    return true;
+  }
+
+  /*! Advances the controller against the scratch command.
+   * @param dt  time step [s]
+   * @returns true if successful
+   */
+  bool advanceInHotStandby(double dt) override {
+    if (!isInHotStandby_) {
+      return false;
+    }
+    isStandbyCommandValid_ = this->advanceController(dt);
+    if (isStandbyCommandValid_) {
+      writeHandOverCommand(IsCommandCopyable());
+    }
+    return isStandbyCommandValid_;
+  }
+
+  /*! Stops the controller against the scratch command and restores the command container.
+   */
+  void leaveHotStandby() override {
+    if (!isInHotStandby_) {
+      return;
+    }
+
+    // Stop against the scratch command, stopping might write the command
+    if (this->isInitialized()) {
+      this->preStopController();
+      this->stopController();
+    }
+    restoreCommand();
+  }
+
+  /*! Restores the command container and copies the last command computed in shadow into it.
+   * @returns true iff the last advance in shadow was successful (otherwise the command is left untouched)
+   */
+  bool takeOverFromHotStandby() override {
+    if (!isInHotStandby_) {
+      return false;
+    }
+    restoreCommand();
+    if (!isStandbyCommandValid_ || !copyStandbyCommand(IsCommandCopyable())) {
+      return false;
+    }
+    this->isRunning_ = true;
+    return true;
+  }
+
+  /*! Copies the last command completed in hot standby into the command container and publishes it, the controller is not touched.
+   *  Can be called while the controller is advanced in hot standby (by a single thread at a time).
+   * @returns true iff an advance in hot standby completed since entering it
+   */
+  bool handOverStandbyCommand() override { return handOverStandbyCommand(IsCommandCopyable()); }
+
+  /*! Indicates whether the controller is in hot standby.
+   * @returns true iff the command is redirected
+   */
+  bool isInHotStandby() const override { return isInHotStandby_; }
+
+ protected:
+  //! Restores the command container without touching it
+  void restoreCommand() {
+    if (isInHotStandby_) {
+      isHandOverCommandValid_ = false;
+      this->exchangeCommand(standbyCommand_, standbyCommandMutex_, standbyCommandChannel_);
+      isInHotStandby_ = false;
+    }
+  }
+
+  //! Hot standby requires copying the command
+  using IsCommandCopyable =
+      std::integral_constant<bool, std::is_copy_constructible<Command>::value && std::is_copy_assignable<Command>::value>;
+
+  /*! Creates the scratch command container as a copy of the command.
+   * @returns true if successful
+   */
+  bool makeStandbyCommand(std::true_type /*isCommandCopyable*/) {
+    boost::shared_lock<boost::shared_mutex> lock(this->getCommandMutex());
+    standbyCommand_ = std::make_shared<Command>(this->getCommand());
+    standbyCommandMutex_ = std::make_shared<boost::shared_mutex>();
+    standbyCommandChannel_.reset();
+    if (handOverCommands_ == nullptr) {
+      handOverCommands_.reset(new typename Base::CommandChannel(*standbyCommand_));
+    }
+    return true;
+  }
+  bool makeStandbyCommand(std::false_type /*isCommandCopyable*/) { return false; }
+
+  /*! Copies the scratch command into the command container and publishes it.
+   * @returns true if successful
+   */
+  bool copyStandbyCommand(std::true_type /*isCommandCopyable*/) {
+    boost::unique_lock<boost::shared_mutex> lock(this->getCommandMutex());
+    this->getCommand() = *standbyCommand_;
+    this->publishCommand();
+    return true;
+  }
+  bool copyStandbyCommand(std::false_type /*isCommandCopyable*/) { return false; }
+
+  //! Hands the scratch command of a completed advance over to handOverStandbyCommand()
+  void writeHandOverCommand(std::true_type /*isCommandCopyable*/) {
+    handOverCommands_->write(this->getCommand());
+    isHandOverCommandValid_ = true;
+  }
+  void writeHandOverCommand(std::false_type /*isCommandCopyable*/) {}
+
+  /*! Copies the latest handed over command into the command container and publishes it.
+   * @returns true if successful
+   */
+  bool handOverStandbyCommand(std::true_type /*isCommandCopyable*/) {
+    if (!isHandOverCommandValid_) {
+      return false;
+    }
+    handOverCommands_->update();
+    boost::unique_lock<boost::shared_mutex> lock(*handOverCommandMutex_);
+    *handOverCommand_ = handOverCommands_->getReadBuffer();
+    if (handOverCommandChannel_ != nullptr) {
+      handOverCommandChannel_->write(*handOverCommand_);
+    }
+    return true;
+  }
+  bool handOverStandbyCommand(std::false_type /*isCommandCopyable*/) { return false; }
+
+ protected:
+  //! Command container, mutex and channel exchanged with the ones of the controller (scratch while not in hot standby)
+  std::shared_ptr<Command> standbyCommand_;
+  std::shared_ptr<boost::shared_mutex> standbyCommandMutex_;
+  std::shared_ptr<typename Base::CommandChannel> standbyCommandChannel_;
+  //! Indicates if the command is redirected
+  std::atomic_bool isInHotStandby_{false};
+  //! Indicates if the last advance in hot standby was successful
+  bool isStandbyCommandValid_{false};
+  //! Commands of the completed advances in hot standby, written by the hot standby thread and read by handOverStandbyCommand()
+  std::unique_ptr<typename Base::CommandChannel> handOverCommands_;
+  //! Command container, mutex and channel of the controller while in hot standby (valid while isHandOverCommandValid_ is set)
+  std::shared_ptr<Command> handOverCommand_;
+  std::shared_ptr<boost::shared_mutex> handOverCommandMutex_;
+  std::shared_ptr<typename Base::CommandChannel> handOverCommandChannel_;
+  //! Indicates if an advance in hot standby completed since entering it
+  std::atomic_bool isHandOverCommandValid_{false};
 };
 
 }  // namespace rocoma
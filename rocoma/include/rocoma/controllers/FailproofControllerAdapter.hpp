@@ -84,7 +84,13 @@ class FailproofControllerAdapter : virtual public roco::FailproofControllerAdapt
   /*! Adapts the adaptees advance(dt) function.
    * @param dt  time step [s]
    */
-  void advanceController(double dt) override { this->advance(dt); }
+  void advanceController(double dt) override {
+    this->advance(dt);
+    if (this->hasCommandChannel()) {
+      boost::unique_lock<boost::shared_mutex> lock(this->getCommandMutex());
+      this->publishCommand();
+    }
+  }
 
   /*! Adapts the adaptees cleanup() function.
    * @returns true if successful
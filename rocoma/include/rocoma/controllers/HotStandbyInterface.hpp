@@ -0,0 +1,83 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     HotStandbyInterface.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+namespace rocoma {
+
+//! Interface of emergency controllers that can be advanced in shadow (the manager accesses it via dynamic_cast)
+class HotStandbyInterface {
+ public:
+  //! Default destructor
+  virtual ~HotStandbyInterface() = default;
+
+  /*! Redirects the command to a scratch container and fast initializes the controller against it.
+   * @param dt  time step [s]
+   * @returns true iff the controller is in hot standby
+   */
+  virtual bool enterHotStandby(double dt) = 0;
+
+  /*! Advances the controller against the scratch command.
+   * @param dt  time step [s]
+   * @returns true if successful
+   */
+  virtual bool advanceInHotStandby(double dt) = 0;
+
+  /*! Stops the controller against the scratch command and restores the command container (never called on the tick thread).
+   */
+  virtual void leaveHotStandby() = 0;
+
+  /*! Restores the command container and copies the last command computed in shadow into it.
+   * @returns true iff the last advance in shadow was successful (otherwise the command is left untouched)
+   */
+  virtual bool takeOverFromHotStandby() = 0;
+
+  /*! Copies the last command completed in hot standby into the command container and publishes it, the controller is not touched.
+   *  Can be called while the controller is advanced in hot standby (by a single thread at a time).
+   * @returns true iff an advance in hot standby completed since entering it
+   */
+  virtual bool handOverStandbyCommand() = 0;
+
+  /*! Indicates whether the controller is in hot standby.
+   * @returns true iff the command is redirected
+   */
+  virtual bool isInHotStandby() const = 0;
+};
+
+}  // namespace rocoma
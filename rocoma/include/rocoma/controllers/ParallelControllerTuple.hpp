@@ -0,0 +1,269 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     ParallelControllerTuple.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// rocoma
+#include "rocoma/common/ParallelAdvancePool.hpp"
+#include "rocoma/controllers/StaticControllerTuple.hpp"
+
+// Message logger
+#include <message_logger/message_logger.hpp>
+
+// STL
+#include <algorithm>
+#include <array>
+#include <exception>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+namespace rocoma {
+
+namespace internal {
+
+template <typename T_>
+struct VoidType {
+  using type = void;
+};
+
+//! Index of a type in a list of types (compile error if it is not in the list)
+template <typename T_, typename... Ts_>
+struct IndexOf;
+
+template <typename T_, typename... Ts_>
+struct IndexOf<T_, T_, Ts_...> : std::integral_constant<std::size_t, 0u> {};
+
+template <typename T_, typename U_, typename... Ts_>
+struct IndexOf<T_, U_, Ts_...> : std::integral_constant<std::size_t, 1u + IndexOf<T_, Ts_...>::value> {};
+
+//! Indices of the dependencies of a member within the members of the tuple
+template <typename Dependencies_, typename... Controllers_>
+struct DependencyIndices;
+
+template <typename... Dependencies_, typename... Controllers_>
+struct DependencyIndices<std::tuple<Dependencies_...>, Controllers_...> {
+  static std::vector<std::size_t> get() { return std::vector<std::size_t>{IndexOf<Dependencies_, Controllers_...>::value...}; }
+};
+
+}  // namespace internal
+
+/*! Members of a ParallelControllerTuple a controller has to be advanced after.
+ *  Declare them as std::tuple in a nested type AdvanceDependencies of the controller, or specialize this trait.
+ */
+template <typename Controller_, typename = void>
+struct AdvanceDependencies {
+  using type = std::tuple<>;
+};
+
+template <typename Controller_>
+struct AdvanceDependencies<Controller_, typename internal::VoidType<typename Controller_::AdvanceDependencies>::type> {
+  using type = typename Controller_::AdvanceDependencies;
+};
+
+//! Controller tuple advancing its independent members concurrently.
+/*! All phases but advance run sequentially as in StaticControllerTuple. Advance runs the members in levels: a member is advanced
+ *  after all members it depends on (see AdvanceDependencies), members of the same level are advanced concurrently and each level
+ *  ends with a barrier.
+ *  Members of the same level must therefore not write the same parts of the command. Advance stops after a level with a failed member.
+ *  The schedule only depends on the declared dependencies, not on the timing of the members.
+ */
+template <typename State_, typename Command_, typename... Controllers_>
+class ParallelControllerTuple : public StaticControllerTuple<State_, Command_, Controllers_...> {
+ public:
+  //! Convenience typedefs
+  using Base = StaticControllerTuple<State_, Command_, Controllers_...>;
+  using State = State_;
+  using Command = Command_;
+
+  //! Number of members
+  static constexpr std::size_t numControllers_ = sizeof...(Controllers_);
+
+ public:
+  //! Constructor
+  ParallelControllerTuple()
+      : Base(),
+        dependencies_{internal::DependencyIndices<typename AdvanceDependencies<Controllers_>::type, Controllers_...>::get()...},
+        levels_(),
+        poolOptions_(),
+        hasPoolOptions_(false),
+        pool_(nullptr),
+        advanceTask_([this](std::size_t i) { advanceMember((*currentLevel_)[i]); }),
+        currentLevel_(nullptr),
+        dt_(0.0),
+        results_(numControllers_, 0),
+        exceptions_(numControllers_) {}
+
+  //! Default destructor
+  ~ParallelControllerTuple() override = default;
+
+  /*! Set the worker threads advancing the members (must be called before create).
+   *  Default: one thread less than the widest level, not pinned, scheduled like the thread calling advance.
+   * @param options  Number, pinning and priority of the worker threads
+   */
+  void setParallelAdvancePoolOptions(const ParallelAdvancePoolOptions& options) {
+    poolOptions_ = options;
+    hasPoolOptions_ = true;
+  }
+
+  //! @returns the members advanced concurrently, level by level (empty before create)
+  const std::vector<std::vector<std::size_t>>& getAdvanceLevels() const { return levels_; }
+
+ protected:
+  bool create(double dt) override {
+    if (!makeAdvanceLevels()) {
+      return false;
+    }
+    std::size_t maxLevelSize = 0u;
+    for (const auto& level : levels_) {
+      maxLevelSize = std::max(maxLevelSize, level.size());
+    }
+    ParallelAdvancePoolOptions options = poolOptions_;
+    if (!hasPoolOptions_) {
+      options.numThreads = static_cast<unsigned int>(maxLevelSize - 1u);
+    }
+    pool_.reset(new ParallelAdvancePool(options));
+    return Base::create(dt);
+  }
+
+  bool advance(double dt) override {
+    dt_ = dt;
+    for (const auto& level : levels_) {
+      currentLevel_ = &level;
+      pool_->run(level.size(), advanceTask_);
+
+      // Rethrow in the calling thread (lowest member first), the adapter handles exceptions. The exceptions of the other members of
+      // the level are dropped, the next advance must not rethrow them.
+      std::exception_ptr exception;
+      for (const std::size_t member : level) {
+        if (exception == nullptr) {
+          exception = exceptions_[member];
+        }
+        exceptions_[member] = nullptr;
+      }
+      if (exception != nullptr) {
+        std::rethrow_exception(exception);
+      }
+
+      // Members of the following levels depend on these ones
+      for (const std::size_t member : level) {
+        if (results_[member] == 0) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  bool cleanup() override {
+    const bool success = Base::cleanup();
+    pool_.reset();
+    return success;
+  }
+
+ private:
+  //! Advances a single member, called on the workers
+  void advanceMember(std::size_t member) {
+    try {
+      results_[member] = static_cast<char>(advanceFunctions()[member](*this, dt_));
+    } catch (...) {
+      results_[member] = 0;
+      exceptions_[member] = std::current_exception();
+    }
+  }
+
+  template <typename Controller_>
+  static bool advanceController(ParallelControllerTuple& tuple, double dt) {
+    return tuple.Controller_::advance(dt);
+  }
+
+  //! @returns the advance functions of the members by index
+  static const std::array<bool (*)(ParallelControllerTuple&, double), numControllers_>& advanceFunctions() {
+    static const std::array<bool (*)(ParallelControllerTuple&, double), numControllers_> functions{
+        {&ParallelControllerTuple::advanceController<Controllers_>...}};
+    return functions;
+  }
+
+  //! Assigns every member the level after its latest dependency
+  bool makeAdvanceLevels() {
+    std::vector<std::size_t> memberLevels(numControllers_, 0u);
+    bool changed = true;
+    for (std::size_t iteration = 0u; changed; ++iteration) {
+      if (iteration > numControllers_) {
+        MELO_ERROR_STREAM("[ParallelControllerTuple][" << this->getName() << "] The advance dependencies of the members are cyclic!");
+        return false;
+      }
+      changed = false;
+      for (std::size_t member = 0u; member < numControllers_; ++member) {
+        for (const std::size_t dependency : dependencies_[member]) {
+          if (memberLevels[member] <= memberLevels[dependency]) {
+            memberLevels[member] = memberLevels[dependency] + 1u;
+            changed = true;
+          }
+        }
+      }
+    }
+
+    levels_.assign(*std::max_element(memberLevels.begin(), memberLevels.end()) + 1u, std::vector<std::size_t>());
+    for (std::size_t member = 0u; member < numControllers_; ++member) {
+      levels_[memberLevels[member]].push_back(member);
+    }
+    return true;
+  }
+
+ private:
+  //! Dependencies of the members by index
+  const std::vector<std::vector<std::size_t>> dependencies_;
+  //! Members advanced concurrently, level by level
+  std::vector<std::vector<std::size_t>> levels_;
+  //! Worker threads
+  ParallelAdvancePoolOptions poolOptions_;
+  bool hasPoolOptions_;
+  std::unique_ptr<ParallelAdvancePool> pool_;
+  //! Task advancing the members of the current level (created once, running a level does not allocate)
+  const ParallelAdvancePool::Task advanceTask_;
+  const std::vector<std::size_t>* currentLevel_;
+  double dt_;
+  //! Result and exception of the last advance per member (written by the workers, read after the barrier)
+  std::vector<char> results_;
+  std::vector<std::exception_ptr> exceptions_;
+};
+
+}  // namespace rocoma
@@ -0,0 +1,87 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     ShadowInterface.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+namespace rocoma {
+
+//! Interface of controllers that can be advanced in shadow of the active one (the manager accesses it via dynamic_cast)
+class ShadowInterface {
+ public:
+  //! Default destructor
+  virtual ~ShadowInterface() = default;
+
+  /*! Redirects state and command to private copies and initializes the controller against them.
+   * @param dt  time step [s]
+   * @returns true iff the controller is in shadow
+   */
+  virtual bool enterShadow(double dt) = 0;
+
+  /*! Copies the state of the current tick into a snapshot for the shadow thread (called on the tick thread).
+   */
+  virtual void publishShadowSnapshot() = 0;
+
+  /*! Copies the state of the latest snapshot into the private state, advances the controller and compares its command to a copy of
+   *  the live command.
+   * @param dt  time step [s]
+   * @returns true if successful
+   */
+  virtual bool advanceInShadow(double dt) = 0;
+
+  /*! Stops the controller and restores state and command.
+   */
+  virtual void leaveShadow() = 0;
+
+  /*! Indicates whether the controller is in shadow.
+   * @returns true iff state and command are redirected
+   */
+  virtual bool isInShadow() const = 0;
+
+  /*! Indicates whether a divergence is defined for the command type (see CommandDivergence).
+   * @returns true iff getCommandDivergence() is meaningful
+   */
+  virtual bool hasCommandDivergence() const = 0;
+
+  /*! Divergence of the private command from the command after the last advance in shadow.
+   * @returns divergence
+   */
+  virtual double getCommandDivergence() const = 0;
+};
+
+}  // namespace rocoma
@@ -0,0 +1,189 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     StaticControllerAdapter.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// Rocoma
+#include "rocoma/common/AsyncLogSink.hpp"
+#include "rocoma/common/TimingStatistics.hpp"
+#include "rocoma/controllers/ControllerAdapter.hpp"
+
+// Roco
+#include "roco/time/TimeStd.hpp"
+
+// STL
+#include <atomic>
+#include <cstdint>
+#include <exception>
+
+namespace rocoma {
+
+//! Check policies: decide if state and command are checked on advance
+//! Checks as set by setIsCheckingState() and setIsCheckingCommand() (as ControllerAdapter)
+struct RuntimeCheckPolicy {
+  static bool isChecking(const std::atomic<bool>& isCheckingFlag) { return isCheckingFlag.load(std::memory_order_relaxed); }
+};
+
+//! Never checks, for controllers whose state and command are checked elsewhere
+struct NoCheckPolicy {
+  static constexpr bool isChecking(const std::atomic<bool>& /*isCheckingFlag*/) { return false; }
+};
+
+//! Time policies: update the controller time on advance
+//! Sets the time to the wall time (as ControllerAdapter)
+struct WallTimePolicy {
+  static void update(roco::time::TimeStd& time) { time.setNow(); }
+};
+
+//! Leaves the time untouched, for controllers that do not use getTime() or get it set by setTime()
+struct ManualTimePolicy {
+  static void update(roco::time::TimeStd& /*time*/) {}
+};
+
+//! Exception policies: handle exceptions thrown while advancing
+//! Catches, logs and fails the advance
+struct CatchExceptionPolicy {
+  template <typename Function_>
+  static bool invoke(const roco::ControllerBase& controller, const Function_& function) {
+    try {
+      return function();
+    } catch (std::exception& e) {
+      AsyncLogSink::getInstance().log(LogMessageId::EXCEPTION_WHILE_ADVANCING, controller.getName(), e.what());
+      return false;
+    } catch (...) {
+      AsyncLogSink::getInstance().log(LogMessageId::UNKNOWN_EXCEPTION_WHILE_ADVANCING, controller.getName());
+      return false;
+    }
+  }
+};
+
+//! Lets exceptions propagate to the caller
+struct PropagateExceptionPolicy {
+  template <typename Function_>
+  static bool invoke(const roco::ControllerBase& /*controller*/, const Function_& function) {
+    return function();
+  }
+};
+
+//! Catches in release builds only (as ControllerAdapter)
+#ifdef NDEBUG
+using DefaultExceptionPolicy = CatchExceptionPolicy;
+#else
+using DefaultExceptionPolicy = PropagateExceptionPolicy;
+#endif
+
+//! Controller adapter with an advance fixed at compile time.
+/*! Checking, timing and exception handling of advanceController() are chosen by the policies. The adaptee is advanced with a
+ *  qualified call (no virtual dispatch), so its advance can be inlined. All other functions are the ones of ControllerAdapter.
+ *  With the default policies the adapter behaves like ControllerAdapter.
+ */
+template <typename Controller_, typename State_, typename Command_, typename CheckPolicy_ = RuntimeCheckPolicy,
+          typename TimePolicy_ = WallTimePolicy, typename ExceptionPolicy_ = DefaultExceptionPolicy>
+class StaticControllerAdapter : public ControllerAdapter<Controller_, State_, Command_> {
+ public:
+  //! Convenience typedefs
+  using Base = ControllerAdapter<Controller_, State_, Command_>;
+  using Controller = Controller_;
+  using State = State_;
+  using Command = Command_;
+  using CheckPolicy = CheckPolicy_;
+  using TimePolicy = TimePolicy_;
+  using ExceptionPolicy = ExceptionPolicy_;
+
+ public:
+  //! Default constructor
+  StaticControllerAdapter() = default;
+
+  //! Default destructor
+  ~StaticControllerAdapter() override = default;
+
+  /*! Adapts the adaptees advance(dt) function.
+   * @param dt  time step [s]
+   * @returns true if successful
+   */
+  bool advanceController(double dt) final {
+    if (!this->isInitialized()) {
+      AsyncLogSink::getInstance().log(LogMessageId::NOT_INITIALIZED_ON_ADVANCE, this->getControllerName());
+      return false;
+    }
+    return ExceptionPolicy_::invoke(*this, [this, dt]() { return advanceWithPolicies(dt); });
+  }
+
+ private:
+  //! Update state, advance and update command
+  bool advanceWithPolicies(double dt) {
+    const std::uint64_t budget = toNanoseconds(dt);
+
+    {
+      ScopedTiming timing(this->timingsOf(this->timings_.updateState_), budget);
+      TimePolicy_::update(this->time_);
+      if (CheckPolicy_::isChecking(this->isCheckingState_)) {
+        boost::shared_lock<boost::shared_mutex> lock(this->getStateMutex());
+        if (!this->getState().checkState()) {
+          AsyncLogSink::getInstance().log(LogMessageId::BAD_STATE, this->getControllerName());
+          return false;
+        }
+      }
+    }
+
+    {
+      ScopedTiming timing(this->timingsOf(this->timings_.advance_), budget);
+      if (!this->Controller_::advance(dt)) {
+        AsyncLogSink::getInstance().log(LogMessageId::COULD_NOT_ADVANCE, this->getControllerName());
+        return false;
+      }
+    }
+
+    {
+      ScopedTiming timing(this->timingsOf(this->timings_.updateCommand_), budget);
+      const bool isCheckingCommand = CheckPolicy_::isChecking(this->isCheckingCommand_);
+      if (isCheckingCommand || this->hasCommandChannel()) {
+        boost::unique_lock<boost::shared_mutex> lock(this->getCommandMutex());
+        if (isCheckingCommand && !this->getCommand().limitCommand()) {
+          AsyncLogSink::getInstance().log(LogMessageId::INVALID_COMMAND, this->getControllerName());
+          return false;
+        }
+        this->publishCommand();
+      }
+    }
+    return true;
+  }
+};
+
+}  // namespace rocoma
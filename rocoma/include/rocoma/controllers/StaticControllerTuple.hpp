@@ -0,0 +1,139 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     StaticControllerTuple.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// roco
+#include "roco/controllers/controllers.hpp"
+
+// STL
+#include <initializer_list>
+#include <tuple>
+#include <type_traits>
+
+namespace rocoma {
+
+//! Controller tuple composed at compile time.
+/*! Like roco::ControllerTuple, the tuple inherits from its members, which share state and command, and runs the members in order
+ *  until the first one fails. The members are called with qualified names (no virtual dispatch), the compiler can inline them into
+ *  the functions of the tuple. Only the call of the tuple by its adapter is virtual.
+ */
+template <typename State_, typename Command_, typename... Controllers_>
+class StaticControllerTuple : virtual public roco::Controller<State_, Command_>, public Controllers_... {
+  static_assert(sizeof...(Controllers_) > 0u, "[StaticControllerTuple]: At least one member is required.");
+
+ public:
+  //! Convenience typedefs
+  using Base = roco::Controller<State_, Command_>;
+  using State = State_;
+  using Command = Command_;
+  using FirstController = typename std::tuple_element<0u, std::tuple<Controllers_...>>::type;
+
+  //! Number of members
+  static constexpr std::size_t numControllers_ = sizeof...(Controllers_);
+
+ public:
+  //! Default constructor
+  StaticControllerTuple() = default;
+
+  //! Default destructor
+  ~StaticControllerTuple() override = default;
+
+ protected:
+  // The initializer lists expand the members in order, && stops at the first member that fails
+  bool create(double dt) override {
+    bool success = true;
+    (void)std::initializer_list<int>{(success = success && this->Controllers_::create(dt), 0)...};
+    return success;
+  }
+
+  bool initialize(double dt) override {
+    bool success = true;
+    (void)std::initializer_list<int>{(success = success && this->Controllers_::initialize(dt), 0)...};
+    return success;
+  }
+
+  bool advance(double dt) override {
+    bool success = true;
+    (void)std::initializer_list<int>{(success = success && this->Controllers_::advance(dt), 0)...};
+    return success;
+  }
+
+  bool reset(double dt) override {
+    bool success = true;
+    (void)std::initializer_list<int>{(success = success && this->Controllers_::reset(dt), 0)...};
+    return success;
+  }
+
+  bool preStop() override {
+    bool success = true;
+    (void)std::initializer_list<int>{(success = success && this->Controllers_::preStop(), 0)...};
+    return success;
+  }
+
+  bool stop() override {
+    bool success = true;
+    (void)std::initializer_list<int>{(success = success && this->Controllers_::stop(), 0)...};
+    return success;
+  }
+
+  bool cleanup() override {
+    bool success = true;
+    (void)std::initializer_list<int>{(success = success && this->Controllers_::cleanup(), 0)...};
+    return success;
+  }
+
+  bool swap(double dt, const roco::ControllerSwapStateInterfacePtr& swapState) override {
+    bool success = true;
+    (void)std::initializer_list<int>{(success = success && this->Controllers_::swap(dt, swapState), 0)...};
+    return success;
+  }
+
+  //! The swap state of the tuple is the swap state of its first member
+  bool getSwapState(roco::ControllerSwapStateInterfacePtr& swapState) override { return this->FirstController::getSwapState(swapState); }
+
+  //! The shared module is added to every member, returns true iff a member accepted it
+  bool addSharedModule(const roco::SharedModulePtr& module) override {
+    bool success = false;
+    (void)std::initializer_list<int>{(success = this->Controllers_::addSharedModule(module) || success, 0)...};
+    return success;
+  }
+};
+
+}  // namespace rocoma
@@ -2,3 +2,4 @@
 #include "rocoma/controllers/ControllerAdapter.hpp"
 #include "rocoma/controllers/EmergencyControllerAdapter.hpp"
 #include "rocoma/controllers/FailproofControllerAdapter.hpp"
+#include "rocoma/controllers/StaticControllerAdapter.hpp"
@@ -33,16 +33,43 @@
 
 // rocoma
 #include "rocoma/ControllerManager.hpp"
+#include "rocoma/controllers/ControllerAdapterExtensionInterface.hpp"
 
 // Message logger
 #include "message_logger/message_logger.hpp"
 
 // STL
 #include <algorithm>
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <functional>
 #include <limits>
+#include <thread>
+#include <unordered_set>
+
+// POSIX
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
 
 namespace rocoma {
 
+namespace {
+
+//! Resident memory of the process [bytes] (0 if unknown)
+std::int64_t getResidentMemory() {
+  std::ifstream statm("/proc/self/statm");
+  std::int64_t size = 0;
+  std::int64_t resident = 0;
+  if (!(statm >> size >> resident)) {
+    return 0;
+  }
+  return resident * static_cast<std::int64_t>(sysconf(_SC_PAGESIZE));
+}
+
+}  // namespace
+
 ControllerManager::ControllerManager() : ControllerManager(ControllerManagerOptions{}) {
   // Hack
   isInitialized_ = false;
@@ -60,10 +87,96 @@ ControllerManager::ControllerManager(const ControllerManagerOptions& options)
       controllerPairs_(),
       activeControllerPair_(nullptr, nullptr),
       failproofController_(nullptr),
+      updateControllerTiming_(),
+      updateControllerLockWait_(),
+      switchControllerTiming_(),
+      controllerMonitors_(),
+      registrationMutex_(),
+      failproofControllerMonitor_(),
+      lastHeartbeat_{0},
+      isHeartbeatMissed_{false},
+      tickCount_{0u},
+      numTickWaiters_{0u},
+      tickPosted_(),
+      swapStateRequest_{SwapStateRequest::NONE},
+      swapStateController_{nullptr},
+      swapState_(nullptr),
+      tickDriver_(nullptr),
+      stopExecutor_(nullptr),
+      uncreatedControllers_(),
+      controllersInCreation_(),
+      failedControllers_(),
+      lazyCreationReport_(),
+      creationMutex_(),
+      creationChanged_(),
+      isStoppingCreateAhead_{false},
+      createAheadThread_(),
+      notifications_(256u),
+      listeners_(),
+      listenerMutex_(),
+      isNotifierRunning_{false},
+      numDroppedNotifications_{0u},
+      isEmergencyStopPending_{false},
+      pendingEmergencyStopType_{EmergencyStopType::NA},
+      numPostingNotifications_{0u},
+      notificationPosted_(),
+      isStoppingNotifier_{false},
+      notifierThread_(),
+      hotStandbyDriver_(nullptr),
+      standbyEmgcyController_(nullptr),
+      standbyController_(nullptr),
+      hotStandbyMutex_(),
+      isHotStandbySuspended_{false},
+      isHotStandbyTicking_{false},
+      hotStandbyHandOver_{nullptr},
+      hotStandbyHandOverStart_(),
+      emergencyStopLatency_(),
+      shadowDriver_(nullptr),
+      shadowController_(nullptr),
+      shadowInterface_(nullptr),
+      shadowReport_(),
+      shadowTiming_(),
+      shadowCommandDivergenceSum_{0.0},
+      lastShadowTick_{0u},
+      shadowMutex_(),
+      shadowAttachMutex_(),
+      shadowSnapshotSource_(nullptr),
+      isShadowAttached_{false},
       controllerMutex_(),
+      dispatchRecord_(),
+      status_(),
+      publishedStatus_(),
+      statusMutex_(),
+      failproofControllerName_(),
       emergencyStopMutex_(),
       updateControllerMutex_(),
-      switchControllerMutex_() {}
+      switchControllerMutex_() {
+  if (options_.asyncLogging) {
+    AsyncLogSink::getInstance().start();
+  }
+  dispatchRecord_.waitForReaders(publishDispatchRecord());
+  setupTickDriver();
+  setupStopExecutor();
+  startWatchdog();
+  startCreateAhead();
+  startHotStandby();
+  startNotifier();
+}
+
+ControllerManager::~ControllerManager() {
+  // The tick drivers, the stop executor, the watchdog and the create ahead thread access the manager.
+  // Stop them before members are destroyed.
+  stopCreateAhead();
+  tickDriver_->stop();
+  stopHotStandby();
+  detachShadowController();
+  stopExecutor_.reset();
+  workerManager_.stopWorkers(true);
+  stopNotifier();
+  if (isInitialized_ && options_.asyncLogging) {
+    AsyncLogSink::getInstance().stop();
+  }
+}
 
 void ControllerManager::init(const ControllerManagerOptions& options) {
   if (isInitialized_) {
@@ -72,8 +185,23 @@ void ControllerManager::init(const ControllerManagerOptions& options) {
   }
   options_ = options;
   clearedEmergencyStop_ = !options.emergencyStopMustBeCleared;
+  publishStatus();
+
+  if (options_.asyncLogging) {
+    AsyncLogSink::getInstance().start();
+  }
+
+  if (options_.allocationTrackingOptions.enable && !AllocationTracker::isAvailable()) {
+    MELO_WARN("[Rocoma] Allocation tracking requires the allocation interposer (ROCOMA_TRACK_ALLOCATIONS). No allocations are counted.");
+  }
 
   isInitialized_ = true;
+  setupTickDriver();
+  setupStopExecutor();
+  startWatchdog();
+  startCreateAhead();
+  startHotStandby();
+  startNotifier();
 }
 
 bool ControllerManager::addControllerPair(ControllerPtr&& controller, EmgcyControllerPtr&& emergencyController) {
@@ -87,14 +215,16 @@ bool ControllerManager::addControllerPair(ControllerPtr&& controller, EmgcyContr
   const std::string controllerName = controller->getControllerName();
 
   // insert controller (move ownership to controller / controller is set to nullptr)
-  controllers_.insert(std::make_pair(controllerName, std::move(controller)));
+  std::unique_lock<std::mutex> lockRegistration(registrationMutex_);
+  const ControllerId controllerId = controllers_.add(controllerName, std::move(controller));
+  lockRegistration.unlock();
   MELO_DEBUG_STREAM("[Rocoma][" << controllerName << "] Successfully added controller!");
 
   //--- Add emergency controller
   const std::string emgcyControllerName =
       emergencyController == nullptr ? failproofController_->getControllerName() : emergencyController->getControllerName();
   if (emergencyController == nullptr) {
-    controllerPairs_.insert(std::make_pair(controllerName, ControllerSetPtr(controllers_.at(controllerName).get(), nullptr)));
+    addControllerSet(controllerId, invalidControllerId);
     MELO_INFO_STREAM("[Rocoma][" << controllerName << " / " << emgcyControllerName << "] Successfully added controller pair.");
     return true;
   }
@@ -103,24 +233,26 @@ bool ControllerManager::addControllerPair(ControllerPtr&& controller, EmgcyContr
   emergencyController->setIsRealRobot(options_.isRealRobot);
 
   // check if emergency controller already exists
-  if (emergencyControllers_.find(emgcyControllerName) != emergencyControllers_.end()) {
+  if (emergencyControllers_.contains(emgcyControllerName)) {
     MELO_INFO_STREAM("[Rocoma][" << emgcyControllerName << "] An emergency controller with the name already exists. Using same instance.");
   } else {
     // create emergency controller
     if (!emergencyController->createController(options_.timeStep)) {
       MELO_WARN_STREAM("[Rocoma][" << emgcyControllerName << "] Could not be created! Use failproof controller on emergency stop!");
-      controllerPairs_.insert(std::make_pair(controllerName, ControllerSetPtr(controllers_.at(controllerName).get(), nullptr)));
+      addControllerSet(controllerId, invalidControllerId);
       return false;
     }
 
     // insert emergency controller (move ownership to controller / controller is set to nullptr)
-    emergencyControllers_.insert(std::make_pair(emgcyControllerName, std::move(emergencyController)));
+    setupControllerMonitor(emergencyController.get());
+    lockRegistration.lock();
+    emergencyControllers_.add(emgcyControllerName, std::move(emergencyController));
+    lockRegistration.unlock();
     MELO_DEBUG_STREAM("[Rocoma][" << emgcyControllerName << "] Successfully added emergency controller!");
   }
 
   // Add controller pair
-  controllerPairs_.insert(std::make_pair(
-      controllerName, ControllerSetPtr(controllers_.at(controllerName).get(), emergencyControllers_.at(emgcyControllerName).get())));
+  addControllerSet(controllerId, emergencyControllers_.getId(emgcyControllerName));
   MELO_INFO_STREAM("[Rocoma][" << controllerName << " / " << emgcyControllerName << "] Successfully added controller pair.");
 
   return true;
@@ -138,24 +270,273 @@ bool ControllerManager::addControllerPairWithExistingEmergencyController(Control
   const std::string controllerName = controller->getControllerName();
 
   // insert controller (move ownership to controller / controller is set to nullptr)
-  controllers_.insert(std::make_pair(controllerName, std::move(controller)));
+  std::unique_lock<std::mutex> lockRegistration(registrationMutex_);
+  const ControllerId controllerId = controllers_.add(controllerName, std::move(controller));
+  lockRegistration.unlock();
   MELO_DEBUG_STREAM("[Rocoma][" << controllerName << "] Successfully added controller!");
 
   // check if emergency controller already exists
-  if (emergencyControllers_.find(emgcyControllerName) != emergencyControllers_.end()) {
+  if (emergencyControllers_.contains(emgcyControllerName)) {
     MELO_INFO_STREAM("[Rocoma][" << emgcyControllerName << "] An emergency controller with the name already exists. Using same instance.");
-    controllerPairs_.insert(std::make_pair(
-        controllerName, ControllerSetPtr(controllers_.at(controllerName).get(), emergencyControllers_.at(emgcyControllerName).get())));
+    addControllerSet(controllerId, emergencyControllers_.getId(emgcyControllerName));
     MELO_INFO_STREAM("[Rocoma][" << controllerName << " / " << emgcyControllerName << "] Successfully added controller pair.");
   } else {
     MELO_WARN_STREAM("[Rocoma][" << emgcyControllerName << "] Does not exist in list! Use failproof controller on emergency stop!");
-    controllerPairs_.insert(std::make_pair(controllerName, ControllerSetPtr(controllers_.at(controllerName).get(), nullptr)));
+    addControllerSet(controllerId, invalidControllerId);
     MELO_INFO_STREAM("[Rocoma][" << controllerName << " / ] Successfully added controller pair.");
   }
 
   return true;
 }
 
+bool ControllerManager::addControllerPairs(std::vector<ControllerPairPtr>&& controllerPairs,
+                                           std::vector<ControllerCreationResult>* results) {
+  if (!checkInitializationAndFailproofController("Could not add controller pairs.")) {
+    return false;
+  }
+  bool success = true;
+
+  //--- Collect the controllers to create
+  struct CreationJob {
+    roco::ControllerAdapterInterface* controller_;
+    std::size_t pairIndex_;
+  };
+  std::vector<CreationJob> jobs;
+  std::vector<ControllerCreationResult> creationResults;
+  std::vector<std::string> emgcyControllerNames(controllerPairs.size());
+  std::unordered_set<std::string> newControllerNames;
+  std::unordered_set<std::string> newEmgcyControllerNames;
+
+  for (std::size_t i = 0u; i < controllerPairs.size(); ++i) {
+    ControllerPtr& controller = controllerPairs[i].first;
+    EmgcyControllerPtr& emgcyController = controllerPairs[i].second;
+    if (controller == nullptr) {
+      MELO_ERROR_STREAM("[Rocoma] Could not add controller pair. Controller is nullptr.");
+      success = false;
+      continue;
+    }
+
+    const std::string controllerName = controller->getControllerName();
+    if (controllers_.contains(controllerName) || !newControllerNames.insert(controllerName).second) {
+      MELO_WARN_STREAM("[Rocoma][" << controllerName << "] Could not add controller. A controller with the same name already exists.");
+      controller.reset(nullptr);
+      success = false;
+      continue;
+    }
+    controller->setIsRealRobot(options_.isRealRobot);
+    jobs.push_back(CreationJob{controller.get(), i});
+
+    if (emgcyController == nullptr) {
+      continue;
+    }
+    emgcyControllerNames[i] = emgcyController->getControllerName();
+    if (emergencyControllers_.contains(emgcyControllerNames[i]) ||
+        !newEmgcyControllerNames.insert(emgcyControllerNames[i]).second) {
+      MELO_INFO_STREAM("[Rocoma][" << emgcyControllerNames[i]
+                                   << "] An emergency controller with the name already exists. Using same instance.");
+      emgcyController.reset(nullptr);
+      continue;
+    }
+    emgcyController->setIsRealRobot(options_.isRealRobot);
+    jobs.push_back(CreationJob{emgcyController.get(), i});
+  }
+
+  creationResults.resize(jobs.size());
+  for (std::size_t j = 0u; j < jobs.size(); ++j) {
+    creationResults[j].controllerName_ = jobs[j].controller_->getControllerName();
+    creationResults[j].isEmergencyController_ = jobs[j].controller_ != controllerPairs[jobs[j].pairIndex_].first.get();
+    creationResults[j].isCreationDeferred_ = options_.lazyControllerCreation && !creationResults[j].isEmergencyController_;
+  }
+  const auto numDeferred = static_cast<std::size_t>(std::count_if(
+      creationResults.begin(), creationResults.end(), [](const ControllerCreationResult& result) { return result.isCreationDeferred_; }));
+
+  //--- Create the controllers on a bounded pool (the calling thread participates)
+  const TimingClock::time_point start = TimingClock::now();
+  const unsigned int maxThreads = options_.maxCreationThreads != 0u ? options_.maxCreationThreads : std::thread::hardware_concurrency();
+  const auto numThreads = static_cast<unsigned int>(
+      std::min<std::size_t>(std::max(maxThreads, 1u), std::max<std::size_t>(jobs.size() - numDeferred, 1u)));
+  std::atomic<std::size_t> nextJob{0u};
+  auto createControllers = [this, &jobs, &creationResults, &nextJob]() {
+    for (std::size_t j = nextJob++; j < jobs.size(); j = nextJob++) {
+      if (creationResults[j].isCreationDeferred_) {
+        creationResults[j].success_ = true;
+        continue;
+      }
+      const TimingClock::time_point createStart = TimingClock::now();
+      creationResults[j].success_ = jobs[j].controller_->createController(options_.timeStep);
+      creationResults[j].createTime_ = static_cast<double>(nanosecondsSince(createStart)) * 1.0e-9;
+    }
+  };
+  std::vector<std::thread> creationThreads;
+  for (unsigned int k = 1u; k < numThreads; ++k) {
+    creationThreads.emplace_back(createControllers);
+  }
+  createControllers();
+  for (auto& creationThread : creationThreads) {
+    creationThread.join();
+  }
+  MELO_INFO("[Rocoma] Created %zu controllers on %u threads in %.3f s (%zu deferred to their first switch).", jobs.size() - numDeferred,
+            numThreads, static_cast<double>(nanosecondsSince(start)) * 1.0e-9, numDeferred);
+
+  //--- Merge the created controllers
+  {
+    boost::unique_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+
+    // Emergency controllers first, the pairs refer to them
+    for (std::size_t j = 0u; j < jobs.size(); ++j) {
+      if (!creationResults[j].isEmergencyController_) {
+        continue;
+      }
+      EmgcyControllerPtr& emgcyController = controllerPairs[jobs[j].pairIndex_].second;
+      if (!creationResults[j].success_) {
+        MELO_WARN_STREAM("[Rocoma][" << creationResults[j].controllerName_
+                                     << "] Could not be created! Use failproof controller on emergency stop!");
+        emgcyController.reset(nullptr);
+        success = false;
+        continue;
+      }
+      setupControllerMonitor(emgcyController.get());
+      std::lock_guard<std::mutex> lockRegistration(registrationMutex_);
+      emergencyControllers_.add(creationResults[j].controllerName_, std::move(emgcyController));
+    }
+
+    for (std::size_t j = 0u; j < jobs.size(); ++j) {
+      if (creationResults[j].isEmergencyController_) {
+        continue;
+      }
+      const std::string& controllerName = creationResults[j].controllerName_;
+      ControllerPtr& controller = controllerPairs[jobs[j].pairIndex_].first;
+      if (!creationResults[j].success_) {
+        MELO_ERROR_STREAM("[Rocoma][" << controllerName << "] Could not create controller!");
+        controller.reset(nullptr);
+        success = false;
+        continue;
+      }
+      setupControllerMonitor(controller.get());
+      if (creationResults[j].isCreationDeferred_) {
+        registerUncreatedController(controller.get());
+      }
+      std::unique_lock<std::mutex> lockRegistration(registrationMutex_);
+      const ControllerId controllerId = controllers_.add(controllerName, std::move(controller));
+      lockRegistration.unlock();
+      controllerPairs_.push_back(makeControllerSet(controllerId, emergencyControllers_.getId(emgcyControllerNames[jobs[j].pairIndex_])));
+      const ControllerSetPtr& controllerPair = controllerPairs_.back();
+      MELO_INFO_STREAM("[Rocoma][" << controllerName << " / "
+                                   << (controllerPair.emgcyController_ != nullptr ? *controllerPair.emgcyControllerName_
+                                                                                  : failproofController_->getControllerName())
+                                   << "] Successfully added controller pair in " << creationResults[j].createTime_ << " s.");
+    }
+  }
+
+  if (results != nullptr) {
+    *results = std::move(creationResults);
+  }
+  return success;
+}
+
+bool ControllerManager::replaceController(ControllerPtr&& controller) {
+  if (controller == nullptr) {
+    MELO_ERROR_STREAM("[Rocoma] Could not replace controller. Controller is nullptr.");
+    return false;
+  }
+  const std::string controllerName = controller->getControllerName();
+  const ControllerId controllerId = controllers_.getId(controllerName);
+  if (controllerId == invalidControllerId) {
+    MELO_ERROR_STREAM("[Rocoma][" << controllerName << "] Could not replace controller. No controller with this name exists.");
+    return false;
+  }
+
+  // Create the new instance off the control thread, the old instance keeps running
+  controller->setIsRealRobot(options_.isRealRobot);
+  if (!controller->createController(options_.timeStep)) {
+    MELO_ERROR_STREAM("[Rocoma][" << controllerName << "] Could not create the new instance. Keep the old one.");
+    return false;
+  }
+
+  // The controller pairs are not changed while switching
+  std::lock_guard<std::mutex> lockSwitchController(switchControllerMutex_);
+  ControllerPtr& registeredController = controllers_[controllerId];
+  roco::ControllerAdapterInterface* oldController = registeredController.get();
+
+  // The old instance stops running in shadow
+  std::unique_lock<std::mutex> lockShadow(shadowMutex_);
+  const bool isShadowController = shadowController_ == oldController;
+  lockShadow.unlock();
+  if (isShadowController) {
+    detachShadowController();
+  }
+
+  // An old instance that was registered lazily and never created is not cleaned up
+  bool isOldControllerCreated = true;
+  if (options_.lazyControllerCreation) {
+    std::unique_lock<std::mutex> lockCreation(creationMutex_);
+    creationChanged_.wait(lockCreation, [this, oldController]() { return controllersInCreation_.count(oldController) == 0u; });
+    auto uncreatedController = std::find(uncreatedControllers_.begin(), uncreatedControllers_.end(), oldController);
+    if (uncreatedController != uncreatedControllers_.end()) {
+      uncreatedControllers_.erase(uncreatedController);
+      isOldControllerCreated = false;
+    } else if (failedControllers_.erase(oldController) != 0u) {
+      isOldControllerCreated = false;
+    }
+  }
+
+  bool isActive = false;
+  {
+    std::unique_lock<std::mutex> lockEmergencyStop(emergencyStopMutex_);
+    boost::shared_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+    isActive = state_ == State::OK && activeControllerPair_.controllerId_ == controllerId;
+  }
+
+  // An inactive controller could still be stopped after an emergency stop
+  if (!isActive && !waitUntilControllerStopped(oldController)) {
+    controller->cleanupController();
+    return false;
+  }
+
+  // Exchange the instances in the registry, the dispatch only sees the active pair
+  ControllerPtr oldControllerPtr;
+  std::size_t retiredDispatchSlot = RcuCell<DispatchRecord>::noSlot_;
+  {
+    boost::unique_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+    std::lock_guard<std::mutex> lockRegistration(registrationMutex_);
+    oldControllerPtr = std::move(registeredController);
+    registeredController = std::move(controller);
+    controllerPairs_[controllerId].controller_ = registeredController.get();
+    if (!isActive && activeControllerPair_.controllerId_ == controllerId) {
+      // The emergency controller of this pair is active
+      activeControllerPair_.controller_ = registeredController.get();
+      retiredDispatchSlot = publishDispatchRecord();
+    }
+  }
+  dispatchRecord_.waitForReaders(retiredDispatchSlot);
+
+  // The active old instance runs until the new instance produced its first command
+  if (isActive) {
+    std::promise<SwitchResponse> responsePromise;
+    if (!makeBeforeBreakSwitch(oldController, registeredController.get(), State::OK, responsePromise)) {
+      // The old instance is still running or was stopped by an emergency stop, it stays registered
+      boost::unique_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+      std::unique_lock<std::mutex> lockRegistration(registrationMutex_);
+      controller = std::move(registeredController);
+      registeredController = std::move(oldControllerPtr);
+      controllerPairs_[controllerId].controller_ = registeredController.get();
+      lockRegistration.unlock();
+      lockControllers.unlock();
+      controller->cleanupController();
+      MELO_ERROR_STREAM("[Rocoma][" << controllerName << "] Could not hand over to the new instance. Keep the old one.");
+      return false;
+    }
+  }
+
+  bool success = true;
+  if (isOldControllerCreated) {
+    success = oldControllerPtr->cleanupController();
+  }
+  oldControllerPtr.reset(nullptr);
+  MELO_INFO_STREAM("[Rocoma][" << controllerName << "] Replaced controller" << (isActive ? " while it was active." : "."));
+  return success;
+}
+
 bool ControllerManager::setFailproofController(FailproofControllerPtr&& controller) {
   if (!isInitialized_ || controller == nullptr) {
     MELO_ERROR("[Rocoma] Could not set failproof controller. Abort!");
@@ -173,14 +554,42 @@ bool ControllerManager::setFailproofController(FailproofControllerPtr&& controll
   }
 
   // move controller
+  failproofControllerMonitor_.budget_ = getControllerBudget(controllerName);
   failproofController_ = std::move(controller);
+  failproofControllerName_ = controllerName;
+  publishStatus();
   MELO_INFO_STREAM("[Rocoma][" << controllerName << "] Successfully added failproof controller!");
 
   return true;
 }
 
 bool ControllerManager::updateController() {
+  ScopedTiming timing(options_.collectTimingStatistics ? &updateControllerTiming_ : nullptr, toNanoseconds(options_.timeStep));
+
+  // Feed the heartbeat watchdog
+  if (options_.deadlineOptions.heartbeatTimeout > 0.0) {
+    lastHeartbeat_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(TimingClock::now().time_since_epoch()).count());
+  }
+
+  // Lock-free dispatch, writers wait for the record to be released
+  if (options_.lockFreeDispatch) {
+    if (!checkInitializationAndFailproofController("Can not advance controller manager.")) {
+      return false;
+    }
+
+    bool successfullyAdvanced = false;
+    EmergencyStopType escalation = EmergencyStopType::NA;
+    {
+      RcuCell<DispatchRecord>::ReadGuard record = dispatchRecord_.read();
+      successfullyAdvanced = advanceActiveController(*record, escalation);
+    }
+
+    // Record must be released, e-stop publishes a new one
+    return handleAdvanceResult(successfullyAdvanced, escalation);
+  }
+
   // Calls to updateController are queued
+  const TimingClock::time_point lockStart = options_.collectTimingStatistics ? TimingClock::now() : TimingClock::time_point();
   std::unique_lock<std::mutex> lockUpdate(updateControllerMutex_);
   if (!checkInitializationAndFailproofController("Can not advance controller manager.")) {
     return false;
@@ -188,26 +597,244 @@ bool ControllerManager::updateController() {
 
   // Run controller
   bool successfullyAdvanced = false;
+  EmergencyStopType escalation = EmergencyStopType::NA;
   {
     boost::shared_lock<boost::shared_mutex> lockControllersForAdvance(controllerMutex_);
-    if (state_ == State::OK) {
-      successfullyAdvanced = activeControllerPair_.controller_->advanceController(options_.timeStep);
-    } else if (state_ == State::EMERGENCY) {
-      successfullyAdvanced = activeControllerPair_.emgcyController_->advanceController(options_.timeStep);
-    } else if (state_ == State::FAILURE) {
-      failproofController_->advanceController(options_.timeStep);
-      successfullyAdvanced = true;
+    if (options_.collectTimingStatistics) {
+      updateControllerLockWait_.record(nanosecondsSince(lockStart), 0u);
+    }
+    successfullyAdvanced = advanceActiveController(makeDispatchRecord(), escalation);
+  }
+
+  return handleAdvanceResult(successfullyAdvanced, escalation);
+}
+
+bool ControllerManager::start() {
+  if (!checkInitializationAndFailproofController("Can not start tick driver.")) {
+    return false;
+  }
+  return tickDriver_->start();
+}
+
+bool ControllerManager::run() {
+  if (!checkInitializationAndFailproofController("Can not run tick driver.")) {
+    return false;
+  }
+  return tickDriver_->run();
+}
+
+void ControllerManager::stop() {
+  tickDriver_->stop();
+}
+
+TickDriverStatistics ControllerManager::getTickDriverStatistics() const {
+  return tickDriver_->getStatistics();
+}
+
+LatencyStatistics ControllerManager::getEmergencyStopLatencyStatistics() const {
+  return emergencyStopLatency_.getStatistics();
+}
+
+LazyCreationReport ControllerManager::getLazyCreationReport() const {
+  std::lock_guard<std::mutex> lockCreation(creationMutex_);
+  return lazyCreationReport_;
+}
+
+void ControllerManager::setupTickDriver() {
+  if (tickDriver_ != nullptr) {
+    tickDriver_->stop();
+  }
+  tickDriver_.reset(new TickDriver(std::bind(&ControllerManager::updateController, this), options_.timeStep, options_.tickDriverOptions));
+}
+
+bool ControllerManager::advanceActiveController(const DispatchRecord& record, EmergencyStopType& escalation) {
+  escalation = EmergencyStopType::NA;
+
+  // Select active controller (nullptr -> failproof controller)
+  roco::ControllerAdapterInterface* controller = nullptr;
+  ControllerMonitor* monitor = nullptr;
+  if (record.state_ == State::OK) {
+    controller = record.controller_;
+    monitor = record.controllerMonitor_;
+  } else if (record.state_ == State::EMERGENCY) {
+    // The hot standby thread has not released the emergency controller yet, the handed over command holds
+    if (hotStandbyHandOver_.load(std::memory_order_acquire) == record.emgcyController_) {
+      return true;
+    }
+    controller = record.emgcyController_;
+    monitor = record.emgcyControllerMonitor_;
+  } else if (record.state_ == State::FAILURE) {
+    monitor = &failproofControllerMonitor_;
+  } else {
+    return false;
+  }
+
+  const bool isTimed = monitor != nullptr && isMeasuringTimings();
+  const TimingClock::time_point start = isTimed ? TimingClock::now() : TimingClock::time_point();
+
+  // Abort in the advance, the stack then shows the allocation
+  const AllocationTrackingOptions& allocationTrackingOptions = options_.allocationTrackingOptions;
+  const bool isTrackingAllocations = monitor != nullptr && allocationTrackingOptions.enable;
+  std::uint64_t allocationsBefore = 0u;
+  if (isTrackingAllocations) {
+    const bool isSteadyState = monitor->allocations_.getNumAdvances() >= allocationTrackingOptions.warmupAdvances;
+    AllocationTracker::setAbortOnAllocation(isSteadyState && allocationTrackingOptions.abortOnAllocation);
+    allocationsBefore = AllocationTracker::getThreadAllocations();
+  }
+
+  bool success = true;
+  if (controller != nullptr) {
+    success = controller->advanceController(options_.timeStep);
+  } else {
+    failproofController_->advanceController(options_.timeStep);
+  }
+
+  if (isTrackingAllocations) {
+    monitor->allocations_.record(AllocationTracker::getThreadAllocations() - allocationsBefore);
+    AllocationTracker::setAbortOnAllocation(false);
+  }
+
+  // Between two advances of the controller, a make-before-break switch might wait for its swap state
+  if (controller != nullptr && swapStateRequest_.load(std::memory_order_acquire) == SwapStateRequest::REQUESTED) {
+    takeRequestedSwapState(controller);
+  }
+
+  // Publish the state of this tick, the shadow thread follows the tick count and reads only the snapshot. Without a shadow controller
+  // the source is not even pinned.
+  if (isShadowAttached_.load(std::memory_order_relaxed)) {
+    RcuCell<ShadowInterface*>::ReadGuard shadowController = shadowSnapshotSource_.read();
+    if (*shadowController != nullptr) {
+      (*shadowController)->publishShadowSnapshot();
+    }
+  }
+
+  // Still protected by the lock or record, the switch relies on the count to detect the first tick of a new controller
+  tickCount_.fetch_add(1u);
+  if (numTickWaiters_.load() != 0u) {
+    tickPosted_.post();
+  }
+  if (monitor != nullptr) {
+    monitor->numTicks_.fetch_add(1u, std::memory_order_relaxed);
+  }
+
+  if (isTimed) {
+    const std::uint64_t duration = nanosecondsSince(start);
+    const bool isOverrun = monitor->timing_.record(duration, monitor->budget_);
+    if (options_.deadlineOptions.enable) {
+      const std::string& controllerName =
+          controller != nullptr ? controller->getControllerName() : failproofController_->getControllerName();
+      escalation = checkDeadline(*monitor, controllerName, duration, isOverrun, controller != nullptr);
     }
   }
 
+  return success;
+}
+
+bool ControllerManager::handleAdvanceResult(bool successfullyAdvanced, EmergencyStopType escalation) {
   // E-stop if advance returned false
-  return (successfullyAdvanced ? true : emergencyStop());
+  if (!successfullyAdvanced) {
+    return emergencyStop();
+  }
+
+  // Escalate deadline overruns
+  return (escalation == EmergencyStopType::NA ? true : emergencyStop(escalation));
+}
+
+ControllerManager::EmergencyStopType ControllerManager::checkDeadline(ControllerMonitor& monitor, const std::string& controllerName,
+                                                                      std::uint64_t duration, bool isOverrun, bool canEscalate) {
+  if (!isOverrun) {
+    monitor.consecutiveOverruns_ = 0u;
+    return EmergencyStopType::NA;
+  }
+
+  ++monitor.consecutiveOverruns_;
+  const DeadlineOptions& deadlineOptions = options_.deadlineOptions;
+  if (deadlineOptions.overrunPolicy == OverrunPolicy::COUNT) {
+    return EmergencyStopType::NA;
+  }
+
+  // Throttled, formatting the numbers does not allocate and the sink prints the message off the tick thread
+  const TimingClock::time_point now = TimingClock::now();
+  if (now - monitor.lastOverrunLog_ >= std::chrono::seconds(1)) {
+    monitor.lastOverrunLog_ = now;
+    char text[AsyncLogSink::maxTextLength_ + 1u];
+    std::snprintf(text, sizeof(text), "%.3f ms, budget is %.3f ms (%u consecutive overruns).", duration * 1.0e-6,
+                  monitor.budget_ * 1.0e-6, monitor.consecutiveOverruns_);
+    AsyncLogSink::getInstance().log(LogMessageId::DEADLINE_OVERRUN, controllerName, text);
+  }
+
+  // The failproof controller can not be escalated
+  if (!canEscalate) {
+    return EmergencyStopType::NA;
+  }
+
+  if (deadlineOptions.overrunPolicy == OverrunPolicy::FAILPROOF_STOP) {
+    monitor.consecutiveOverruns_ = 0u;
+    return EmergencyStopType::FAILPROOF;
+  }
+
+  if (deadlineOptions.overrunPolicy == OverrunPolicy::EMERGENCY_STOP &&
+      monitor.consecutiveOverruns_ >= deadlineOptions.maxConsecutiveOverruns) {
+    monitor.consecutiveOverruns_ = 0u;
+    return EmergencyStopType::EMERGENCY;
+  }
+
+  return EmergencyStopType::NA;
+}
+
+std::uint64_t ControllerManager::getControllerBudget(const std::string& controllerName) const {
+  const DeadlineOptions& deadlineOptions = options_.deadlineOptions;
+  auto budget = deadlineOptions.budgets.find(controllerName);
+  if (budget != deadlineOptions.budgets.end() && budget->second > 0.0) {
+    return toNanoseconds(budget->second);
+  }
+  return toNanoseconds(deadlineOptions.defaultBudget > 0.0 ? deadlineOptions.defaultBudget : options_.timeStep);
+}
+
+void ControllerManager::startWatchdog() {
+  const DeadlineOptions& deadlineOptions = options_.deadlineOptions;
+  if (!isInitialized_ || deadlineOptions.heartbeatTimeout <= 0.0) {
+    return;
+  }
+
+  // Check four times per timeout, the watchdog arms on the first call to updateController
+  lastHeartbeat_ = 0;
+  isHeartbeatMissed_ = false;
+  workerManager_.addWorker(
+      "rocoma_heartbeat_watchdog", deadlineOptions.heartbeatTimeout / 4.0,
+      std::bind(&ControllerManager::watchdogCallback, this, std::placeholders::_1), deadlineOptions.watchdogPriority, true);
+}
+
+bool ControllerManager::watchdogCallback(const any_worker::WorkerEvent& /*event*/) {
+  const std::int64_t lastHeartbeat = lastHeartbeat_.load();
+  if (lastHeartbeat == 0) {
+    return true;
+  }
+
+  const std::int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(TimingClock::now().time_since_epoch()).count();
+  const double timeSinceHeartbeat = static_cast<double>(now - lastHeartbeat) * 1.0e-9;
+  if (timeSinceHeartbeat <= options_.deadlineOptions.heartbeatTimeout) {
+    isHeartbeatMissed_ = false;
+    return true;
+  }
+
+  // Stop once per missed heartbeat period
+  if (!isHeartbeatMissed_.exchange(true)) {
+    MELO_ERROR("[Rocoma] updateController was not called for %.3f s. Failproof stop!", timeSinceHeartbeat);
+    failproofStop();
+  }
+
+  return true;
 }
 
 bool ControllerManager::emergencyStop(EmergencyStopType eStopType) {
-  // A list of controllers that were running during the estop procedure (can be both if emgcy controller fails)
-  std::vector<roco::ControllerAdapterInterface*> controllersToStop;
-  std::string newControllerName;
+  const TimingClock::time_point start = TimingClock::now();
+
+  // Controllers that were running during the estop procedure (can be both if emgcy controller fails), no allocation on the tick
+  std::array<roco::ControllerAdapterInterface*, 2u> controllersToStop{{nullptr, nullptr}};
+  std::size_t numControllersToStop = 0u;
+  const std::string* newControllerName = &failproofControllerName_;
+  std::size_t retiredDispatchSlot = RcuCell<DispatchRecord>::noSlot_;
 
   // This section can only be executed simultaneously once!
   {
@@ -232,13 +859,15 @@ bool ControllerManager::emergencyStop(EmergencyStopType eStopType) {
     }
 
     // Notify emergency stop
-    MELO_ERROR_STREAM("[Rocoma] " << (eStopType == EmergencyStopType::FAILPROOF ? "Failproof" : "Emergency") << " Stop!");
-    notifyEmergencyStop(eStopType);
+    AsyncLogSink::getInstance().log(eStopType == EmergencyStopType::FAILPROOF ? LogMessageId::FAILPROOF_STOP
+                                                                             : LogMessageId::EMERGENCY_STOP);
+    postEmergencyStopNotification(eStopType);
 
     // Check if controller is in failproof state already
     if (state_ == State::FAILURE) {
       MELO_DEBUG("[Rocoma] Failproof controller is already running on emergency stop!");
-      this->notifyControllerManagerStateChanged(state_, clearedEmergencyStop_);
+      publishStatus();
+      this->postStateChangedNotification(state_, clearedEmergencyStop_);
       return true;
     }
 
@@ -250,12 +879,47 @@ bool ControllerManager::emergencyStop(EmergencyStopType eStopType) {
     // If state ok and emergency controller registered -> try to switch to emergency controller
     if (state_ == State::OK) {
       // Add to controllers that must be stopped
-      controllersToStop.push_back(activeControllerPair_.controller_);
+      controllersToStop[numControllersToStop++] = activeControllerPair_.controller_;
 
       if (eStopType == EmergencyStopType::EMERGENCY) {
-        // Init emergency controller fast and only advance if correctly initialized
-        if (activeControllerPair_.emgcyController_->initializeControllerFast(options_.timeStep) &&
-            activeControllerPair_.emgcyController_->advanceController(options_.timeStep)) {
+        // Never block on the hot standby thread, it could be preempted while the caller (tick thread) waits for it. The hot standby
+        // is suspended until the new state is published. If the thread is mid-tick, it might be advancing the emergency controller.
+        std::unique_lock<std::mutex> lockHotStandby(hotStandbyMutex_, std::defer_lock);
+        HotStandbyInterface* hotStandbyController = nullptr;
+        if (hotStandbyDriver_ != nullptr) {
+          isHotStandbySuspended_ = true;
+          if (!lockHotStandby.try_lock() && isHotStandbyTicking_) {
+            hotStandbyController = dynamic_cast<HotStandbyInterface*>(activeControllerPair_.emgcyController_);
+          }
+        }
+
+        // The hot standby thread owns the emergency controller until the end of its tick, it completes the hand over then. Until
+        // then the dispatch skips the emergency controller and the command completed last in shadow holds.
+        if (hotStandbyController != nullptr) {
+          AsyncLogSink::getInstance().log(LogMessageId::EMERGENCY_CONTROLLER_IN_HOT_STANDBY_TICK,
+                                          *activeControllerPair_.emgcyControllerName_);
+          hotStandbyHandOver_.store(activeControllerPair_.emgcyController_, std::memory_order_release);
+          hotStandbyHandOverStart_ = start;
+          if (hotStandbyController->handOverStandbyCommand()) {
+            emergencyStopLatency_.record(nanosecondsSince(start), 0u);
+            hotStandbyHandOverStart_ = TimingClock::time_point();
+          }
+          activeControllerPair_.controller_->setIsRunning(false);
+          newControllerName = activeControllerPair_.emgcyControllerName_;
+          {
+            // Switch to emergency state
+            boost::upgrade_to_unique_lock<boost::shared_mutex> uniqueLockControllers(lockControllers);
+            state_ = State::EMERGENCY;
+            retiredDispatchSlot = publishDispatchRecord();
+          }
+          // Start logger
+          if (options_.loggerOptions.enable) {
+            signal_logger::logger->startLogger(options_.loggerOptions.updateOnStart);
+          }
+        } else if ((lockHotStandby.owns_lock() && takeOverFromHotStandby(activeControllerPair_.emgcyController_)) ||
+                   (activeControllerPair_.emgcyController_->initializeControllerFast(options_.timeStep) &&
+                    activeControllerPair_.emgcyController_->advanceController(options_.timeStep))) {
+          emergencyStopLatency_.record(nanosecondsSince(start), 0u);
           activeControllerPair_.controller_->setIsRunning(false);
           activeControllerPair_.emgcyController_->setIsRunning(true);
           newControllerName = activeControllerPair_.emgcyControllerName_;
@@ -263,6 +927,7 @@ bool ControllerManager::emergencyStop(EmergencyStopType eStopType) {
             // Switch to emergency state
             boost::upgrade_to_unique_lock<boost::shared_mutex> uniqueLockControllers(lockControllers);
             state_ = State::EMERGENCY;
+            retiredDispatchSlot = publishDispatchRecord();
           }
           // Start logger
           if (options_.loggerOptions.enable) {
@@ -271,19 +936,22 @@ bool ControllerManager::emergencyStop(EmergencyStopType eStopType) {
         } else {
           // No success, move on to failproof controller
           eStopType = EmergencyStopType::FAILPROOF;
-          controllersToStop.push_back(activeControllerPair_.emgcyController_);
+          controllersToStop[numControllersToStop++] = activeControllerPair_.emgcyController_;
         }
       }
     }
 
     if (eStopType == EmergencyStopType::FAILPROOF) {
-      if (state_ == State::EMERGENCY) {
-        controllersToStop.push_back(activeControllerPair_.emgcyController_);
+      // The hot standby thread stops an emergency controller that it was not done handing over
+      const bool isHandingOver =
+          activeControllerPair_.emgcyController_ != nullptr && hotStandbyHandOver_.load() == activeControllerPair_.emgcyController_;
+      if (state_ == State::EMERGENCY && !isHandingOver) {
+        controllersToStop[numControllersToStop++] = activeControllerPair_.emgcyController_;
       }
 
       // Add to controllers that must be stopped
       activeControllerPair_.controller_->setIsRunning(false);
-      if (activeControllerPair_.emgcyController_ != nullptr) {
+      if (activeControllerPair_.emgcyController_ != nullptr && !isHandingOver) {
         activeControllerPair_.emgcyController_->setIsRunning(false);
       }
 
@@ -291,24 +959,31 @@ bool ControllerManager::emergencyStop(EmergencyStopType eStopType) {
       {
         boost::upgrade_to_unique_lock<boost::shared_mutex> uniqueLockControllers(lockControllers);
         state_ = State::FAILURE;
+        retiredDispatchSlot = publishDispatchRecord();
       }
 
       // Advance failproof controller
       {
-        MELO_INFO("[Rocoma] Switched to failproof controller!");
+        AsyncLogSink::getInstance().log(LogMessageId::SWITCHED_TO_FAILPROOF_CONTROLLER);
         failproofController_->advanceController(options_.timeStep);
-        newControllerName = failproofController_->getControllerName();
+        emergencyStopLatency_.record(nanosecondsSince(start), 0u);
       }
     }
+
+    // The new state is published, the hot standby thread follows it
+    isHotStandbySuspended_ = false;
   }
 
+  // Grace period outside of the locks, the old controllers are stopped only after the dispatch released them
+  dispatchRecord_.waitForReaders(retiredDispatchSlot);
+
   // Notify caller
-  this->notifyControllerChanged(newControllerName);
-  this->notifyControllerManagerStateChanged(state_, clearedEmergencyStop_);
+  this->postControllerChangedNotification(*newControllerName);
+  this->postStateChangedNotification(state_, clearedEmergencyStop_);
 
-  // Stop running controllers
-  for (auto ctrl : controllersToStop) {
-    this->stopController(ctrl);
+  // Stop running controllers (asynchronously, the caller might be the tick thread)
+  for (std::size_t i = 0u; i < numControllersToStop; ++i) {
+    this->stopControllerAsynchronously(controllersToStop[i]);
   }
 
   return true;
@@ -321,8 +996,9 @@ void ControllerManager::clearEmergencyStop() {
 
   if (!clearedEmergencyStop_) {
     clearedEmergencyStop_ = true;
+    publishStatus();
     MELO_INFO("[Rocoma] Cleared Emergency Stop.");
-    notifyControllerManagerStateChanged(state_, clearedEmergencyStop_);
+    postStateChangedNotification(state_, clearedEmergencyStop_);
   }
 }
 
@@ -347,6 +1023,31 @@ ControllerManager::SwitchResponse ControllerManager::switchController(const std:
 }
 
 void ControllerManager::switchController(const std::string& controllerName, std::promise<SwitchResponse>& response_promise) {
+  const ControllerId controllerId = getControllerId(controllerName);
+  if (controllerId == invalidControllerId) {
+    // controller is not part of controller map
+    MELO_INFO("[Rocoma] Controller %s not found!", controllerName.c_str());
+    response_promise.set_value(SwitchResponse::NOTFOUND);
+    return;
+  }
+  this->switchController(controllerId, response_promise);
+}
+
+ControllerManager::SwitchResponse ControllerManager::switchController(ControllerId controllerId) {
+  // init promise and future
+  std::promise<SwitchResponse> switch_promise;
+  std::future<SwitchResponse> switch_future = switch_promise.get_future();
+
+  // switch controller
+  this->switchController(controllerId, std::ref(switch_promise));
+
+  // wait for future result
+  switch_future.wait();
+
+  return switch_future.get();
+}
+
+void ControllerManager::switchController(ControllerId controllerId, std::promise<SwitchResponse>& response_promise) {
   // Allow only sequential calls to switch controller
   std::unique_lock<std::mutex> lockSwitchController(switchControllerMutex_, std::try_to_lock);
   if (!lockSwitchController.owns_lock()) {
@@ -362,26 +1063,56 @@ void ControllerManager::switchController(const std::string& controllerName, std:
     return;
   }
 
-  // Make sure were not in emergency stop procedure when getting state
+  // Make sure were not in emergency stop procedure when getting state, nor handing the emergency controller over from hot standby
+  // Copy the requested pair under the same lock, the pairs grow on registration
   State currentState;
-  {
-    std::unique_lock<std::mutex> lockEmergencyStop(emergencyStopMutex_);
-    boost::shared_lock<boost::shared_mutex> lockControllers(controllerMutex_);
-    currentState = state_;
+  ControllerSetPtr activeControllerPair(nullptr, nullptr);
+  ControllerSetPtr controllerPair(nullptr, nullptr);
+  bool isRegistered = false;
+  bool isHandingOver = true;
+  while (isHandingOver) {
+    {
+      std::unique_lock<std::mutex> lockEmergencyStop(emergencyStopMutex_);
+      boost::shared_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+      currentState = state_;
+      activeControllerPair = activeControllerPair_;
+      isRegistered = controllerId < controllerPairs_.size();
+      if (isRegistered) {
+        controllerPair = controllerPairs_[controllerId];
+      }
+      isHandingOver = hotStandbyHandOver_.load() != nullptr;
+    }
+    if (isHandingOver) {
+      std::this_thread::yield();
+    }
   }
 
   // Check if controller is already active
   {
-    if (currentState == State::OK && controllerName == activeControllerPair_.controllerName_) {
-      MELO_INFO("[Rocoma] Controller %s is already running!", controllerName.c_str());
+    if (currentState == State::OK && controllerId == activeControllerPair.controllerId_) {
+      MELO_INFO("[Rocoma] Controller %s is already running!", activeControllerPair.controllerName_->c_str());
       response_promise.set_value(SwitchResponse::RUNNING);
       return;
     }
   }
 
   // Find controller
-  auto controllerPair = controllerPairs_.find(controllerName);
-  if (controllerPair != controllerPairs_.end()) {
+  if (isRegistered) {
+
+    // Promoting the shadow controller ends its shadow execution
+    std::unique_lock<std::mutex> lockShadow(shadowMutex_);
+    const bool isShadowController = shadowController_ == controllerPair.controller_;
+    lockShadow.unlock();
+    if (isShadowController) {
+      detachShadowController();
+    }
+
+    // Create the controller on its first switch (see lazyControllerCreation)
+    if (!ensureControllerCreated(controllerPair.controller_)) {
+      response_promise.set_value(SwitchResponse::ERROR);
+      return;
+    }
+
     // Switch controller worker
     any_worker::WorkerOptions switchControllerWorkerOptions;
     switchControllerWorkerOptions.timeStep_ = std::numeric_limits<double>::infinity();
@@ -389,19 +1120,21 @@ void ControllerManager::switchController(const std::string& controllerName, std:
     switchControllerWorkerOptions.destructWhenDone_ = true;
 
     // Define callback name and controllers to be switched
+    const TimingClock::time_point start = TimingClock::now();
+    bool switched = false;
     switch (currentState) {
       case State::OK: {
-        this->switchFromOldToNewController(activeControllerPair_.controller_, controllerPair->second.controller_, currentState,
-                                           response_promise);
+        switched = this->switchFromOldToNewController(activeControllerPair_.controller_, controllerPair.controller_, currentState,
+                                                      response_promise);
         break;
       }
       case State::EMERGENCY: {
-        this->switchFromOldToNewController(activeControllerPair_.emgcyController_, controllerPair->second.controller_, currentState,
-                                           response_promise);
+        switched = this->switchFromOldToNewController(activeControllerPair_.emgcyController_, controllerPair.controller_,
+                                                      currentState, response_promise);
         break;
       }
       case State::FAILURE: {
-        this->switchFromOldToNewController(nullptr, controllerPair->second.controller_, currentState, response_promise);
+        switched = this->switchFromOldToNewController(nullptr, controllerPair.controller_, currentState, response_promise);
         break;
       }
       case State::NA: {
@@ -410,62 +1143,76 @@ void ControllerManager::switchController(const std::string& controllerName, std:
         return;
       }
     }
+    if (switched) {
+      switchControllerTiming_.record(nanosecondsSince(start), 0u);
+    }
     return;
   } else {
     // controller is not part of controller map
-    MELO_INFO("[Rocoma] Controller %s not found!", controllerName.c_str());
+    MELO_INFO("[Rocoma] Controller with id %u not found!", controllerId);
     response_promise.set_value(SwitchResponse::NOTFOUND);
     return;
   }
 }
 
 std::vector<std::string> ControllerManager::getAvailableControllerNames() const {
-  // Fill vector of controller names
-  std::vector<std::string> controllerNames;
-  for (auto& controller : controllers_) {
-    controllerNames.push_back(controller.first);
-  }
-
-  // Sort them alphabetically
-  std::sort(controllerNames.begin(), controllerNames.end(), std::less<std::string>());
+  // Sorted alphabetically on registration, copied since a registration may reallocate the table
+  std::lock_guard<std::mutex> lockRegistration(registrationMutex_);
+  return controllers_.getSortedNames();
+}
 
-  return controllerNames;
+ControllerId ControllerManager::getControllerId(const std::string& controllerName) const {
+  std::lock_guard<std::mutex> lockRegistration(registrationMutex_);
+  return controllers_.getId(controllerName);
 }
 
 std::string ControllerManager::getActiveControllerName() const {
-  std::string controllerName = "-";
-  boost::shared_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+  const Status status = status_.load();
+  return status.activeControllerName_ != nullptr ? *status.activeControllerName_ : std::string("-");
+}
 
-  switch (state_) {
-    case State::OK: {
-      controllerName = activeControllerPair_.controllerName_;
-      break;
-    }
-    case State::EMERGENCY: {
-      controllerName = activeControllerPair_.emgcyControllerName_;
-      break;
-    }
-    case State::FAILURE: {
-      controllerName = failproofController_ != nullptr ? failproofController_->getControllerName() : "";
-      break;
-    }
-    case State::NA: {
-      controllerName = "Not available";
-      break;
-    }
-  }
-
-  return controllerName;
+ControllerManager::State ControllerManager::getControllerManagerState() const {
+  return status_.load().state_;
 }
 
-ControllerManager::State ControllerManager::getControllerManagerState() const {
-  boost::shared_lock<boost::shared_mutex> lockControllers(controllerMutex_);
-  return state_;
+ControllerManager::Status ControllerManager::getStatus() const {
+  Status status = status_.load();
+  status.tickCount_ = tickCount_.load(std::memory_order_acquire);
+  return status;
 }
 
 bool ControllerManager::cleanup() {
   bool success = true;
 
+  // Stop updating the controllers
+  tickDriver_->stop();
+  stopHotStandby();
+  detachShadowController();
+
+  // Stop creating controllers ahead, the controllers that were never created are not cleaned up
+  stopCreateAhead();
+  const LazyCreationReport lazyCreationReport = getLazyCreationReport();
+  if (lazyCreationReport.numRegisteredControllers_ > 0u) {
+    const unsigned int numCreated = lazyCreationReport.numCreatedControllers_;
+    const unsigned int numNeverCreated = lazyCreationReport.numRegisteredControllers_ - numCreated;
+    const double scale = numCreated > 0u ? static_cast<double>(numNeverCreated) / static_cast<double>(numCreated) : 0.0;
+    MELO_INFO("[Rocoma] %u of %u lazily registered controllers were never created, saving about %.3f s and %.1f MB.", numNeverCreated,
+              lazyCreationReport.numRegisteredControllers_, scale * lazyCreationReport.createTime_,
+              scale * static_cast<double>(lazyCreationReport.residentMemory_) * 1.0e-6);
+  }
+  std::unordered_set<roco::ControllerAdapterInterface*> uncreatedControllers;
+  {
+    std::lock_guard<std::mutex> lockCreation(creationMutex_);
+    uncreatedControllers.insert(failedControllers_.begin(), failedControllers_.end());
+    uncreatedControllers.insert(uncreatedControllers_.begin(), uncreatedControllers_.end());
+  }
+
+  // Stop the watchdog before locking the controllers, it calls failproofStop which can not complete while they are locked
+  if (options_.deadlineOptions.heartbeatTimeout > 0.0) {
+    workerManager_.stopWorker("rocoma_heartbeat_watchdog", true);
+    lastHeartbeat_ = 0;
+  }
+
   // Move to failproof controller
   std::unique_lock<std::mutex> lockEmergencyController(emergencyStopMutex_);
   if (state_ != State::FAILURE) {
@@ -473,6 +1220,13 @@ bool ControllerManager::cleanup() {
     success = failproofStop();
   }
 
+  // Finish pending controller stops. The executor is joined even after a timeout, it must not stop controllers that are released below.
+  if (!waitForStoppedControllers(options_.controllerStopTimeout)) {
+    MELO_ERROR("[Rocoma] Controllers were not stopped within %f s. Waiting for the stop executor.", options_.controllerStopTimeout);
+    success = false;
+  }
+  stopExecutor_.reset();
+
   boost::unique_lock<boost::shared_mutex> lockControllers(controllerMutex_);
 
   // stop all workers
@@ -483,30 +1237,42 @@ bool ControllerManager::cleanup() {
   // TODO(ghottiger) wait for controllers to be finished initializing
   MELO_DEBUG("[Rocoma] Cleaning all controllers up.");
   for (auto& controller : controllers_) {
-    while (controller.second->isBeingStopped()) {
-      MELO_INFO_THROTTLE_STREAM(1.0, "Stopping controller " << controller.first);
+    if (!waitUntilControllerStopped(controller.get())) {
+      // Do not destroy a controller that is still in use
+      controller.release();
+      success = false;
+      continue;
+    }
+    if (uncreatedControllers.count(controller.get()) == 0u) {
+      success = controller->cleanupController() && success;
     }
-    success = controller.second->cleanupController() && success;
     // clean up unique ptrs here.
     // They are managed by ControllerManager and are pointing to instances classes found in dynamically loaded libraries.
     // The libraries are loaded and managed by the child class ControllerManagerRos. The destructor of ControllerManagerRos is called before
     // the destructor of ControllerManager, cleaning up the loaded libraries. This leaves these unique_ptrs pointing to an instance of an
     // unknown class.
-    controller.second.reset(nullptr);
+    controller.reset(nullptr);
   }
 
   MELO_DEBUG("[Rocoma] Cleaning all emergency controllers up.");
   for (auto& emergency_controller : emergencyControllers_) {
-    while (emergency_controller.second->isBeingStopped()) {
+    if (!waitUntilControllerStopped(emergency_controller.get())) {
+      emergency_controller.release();  // see above
+      success = false;
+      continue;
     }
-    success = emergency_controller.second->cleanupController() && success;
-    emergency_controller.second.reset(nullptr);  // clean up unique ptrs here, see above
+    success = emergency_controller->cleanupController() && success;
+    emergency_controller.reset(nullptr);  // clean up unique ptrs here, see above
   }
 
   MELO_DEBUG("[Rocoma] Reset fail proof controller.");
   failproofController_->cleanupController();
   failproofController_.reset(nullptr);  // clean up unique ptrs here, see above
 
+  // Deliver the pending notifications while the notify functions of subclasses can still be called
+  lockControllers.unlock();
+  stopNotifier();
+
   return success;
 }
 
@@ -521,7 +1287,7 @@ bool ControllerManager::createController(const ControllerPtr& controller) {
   const std::string controllerName = controller->getControllerName();
 
   // check if controller already exists
-  if (controllers_.find(controllerName) != controllers_.end()) {
+  if (controllers_.contains(controllerName)) {
     MELO_WARN_STREAM("[Rocoma][" << controllerName << "] Could not add controller. A controller with the same name already exists.");
     return false;
   }
@@ -532,12 +1298,16 @@ bool ControllerManager::createController(const ControllerPtr& controller) {
   // Set controller properties
   controller->setIsRealRobot(options_.isRealRobot);
 
-  // create controller
-  if (!controller->createController(options_.timeStep)) {
+  // create controller (on the first switch if created lazily)
+  if (options_.lazyControllerCreation) {
+    registerUncreatedController(controller.get());
+  } else if (!controller->createController(options_.timeStep)) {
     MELO_ERROR_STREAM("[Rocoma][" << controllerName << "] Could not create controller!");
     return false;
   }
 
+  setupControllerMonitor(controller.get());
+
   return true;
 }
 
@@ -547,17 +1317,552 @@ bool ControllerManager::stopController(roco::ControllerAdapterInterface* control
   if (!controller->isBeingStopped()) {
     // Stop controller and block -> switch controller can not happen while controller is stopped
     controller->setIsBeingStopped(true);
-    success = controller->preStopController();
-    success = controller->stopController() && success;
-    controller->setIsBeingStopped(false);
+    success = finishStoppingController(controller);
   }
 
   return success;
 }
 
+void ControllerManager::stopControllerAsynchronously(roco::ControllerAdapterInterface* controller) {
+  if (stopExecutor_ == nullptr) {
+    stopController(controller);
+    return;
+  }
+
+  if (!controller->isBeingStopped()) {
+    // Flag before queuing -> switch controller waits until the executor stopped the controller
+    controller->setIsBeingStopped(true);
+    if (!stopExecutor_->submit(controller)) {
+      MELO_WARN_STREAM("[Rocoma][" << controller->getControllerName() << "] Stop executor queue is full. Stopping synchronously.");
+      finishStoppingController(controller);
+    }
+  }
+}
+
+bool ControllerManager::finishStoppingController(roco::ControllerAdapterInterface* controller) {
+  bool success = controller->preStopController();
+  success = controller->stopController() && success;
+  controller->setIsBeingStopped(false);
+  return success;
+}
+
+bool ControllerManager::waitUntilControllerStopped(roco::ControllerAdapterInterface* controller) const {
+  if (!controller->isBeingStopped()) {
+    return true;
+  }
+  MELO_INFO_STREAM("[Rocoma][" << controller->getControllerName() << "] Controller is currently being stopped. Wait for completion.");
+
+  // Rocoma adapters signal the completion, poll others
+  bool isStopped = false;
+  auto extension = dynamic_cast<const ControllerAdapterExtensionInterface*>(controller);
+  if (extension != nullptr) {
+    isStopped = extension->waitUntilStopped(options_.controllerStopTimeout);
+  } else {
+    const TimingClock::time_point deadline = TimingClock::now() + std::chrono::nanoseconds(toNanoseconds(options_.controllerStopTimeout));
+    while (controller->isBeingStopped() && TimingClock::now() < deadline) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    isStopped = !controller->isBeingStopped();
+  }
+
+  if (!isStopped) {
+    MELO_ERROR_STREAM("[Rocoma][" << controller->getControllerName() << "] Controller was not stopped within "
+                                  << options_.controllerStopTimeout << " s.");
+  }
+  return isStopped;
+}
+
+bool ControllerManager::waitForStoppedControllers(double timeout) {
+  return stopExecutor_ == nullptr || stopExecutor_->waitUntilIdle(timeout);
+}
+
+void ControllerManager::setupStopExecutor() {
+  stopExecutor_.reset();
+  if (options_.stopControllersAsynchronously) {
+    stopExecutor_.reset(new StopExecutor([this](roco::ControllerAdapterInterface* controller) { finishStoppingController(controller); }));
+  }
+}
+
+void ControllerManager::startHotStandby() {
+  if (!options_.hotStandbyEmergencyControllers || hotStandbyDriver_ != nullptr) {
+    return;
+  }
+  hotStandbyDriver_.reset(
+      new TickDriver([this]() { return advanceHotStandby(); }, options_.timeStep, options_.hotStandbyTickDriverOptions));
+  if (!hotStandbyDriver_->start()) {
+    MELO_WARN("[Rocoma] Could not start hot standby of the emergency controllers.");
+    hotStandbyDriver_.reset();
+  }
+}
+
+void ControllerManager::stopHotStandby() {
+  if (hotStandbyDriver_ == nullptr) {
+    return;
+  }
+  hotStandbyDriver_->stop();
+  std::lock_guard<std::mutex> lockHotStandby(hotStandbyMutex_);
+  isHotStandbyTicking_ = true;
+  completeHotStandbyHandOver();
+  if (standbyController_ != nullptr) {
+    standbyController_->leaveHotStandby();
+  }
+  standbyController_ = nullptr;
+  standbyEmgcyController_ = nullptr;
+  isHotStandbyTicking_ = false;
+}
+
+bool ControllerManager::advanceHotStandby() {
+  std::lock_guard<std::mutex> lockHotStandby(hotStandbyMutex_);
+
+  // Announce the tick before checking for a suspension, an emergency stop that can not lock then knows whether it may use the
+  // emergency controller (both flags are sequentially consistent)
+  isHotStandbyTicking_ = true;
+  if (isHotStandbySuspended_) {
+    isHotStandbyTicking_ = false;
+    return true;
+  }
+  completeHotStandbyHandOver();
+
+  // Follow the active pair, the emergency stop publishes the new state while holding the hot standby lock
+  roco::EmergencyControllerAdapterInterface* emgcyController = nullptr;
+  {
+    RcuCell<DispatchRecord>::ReadGuard record = dispatchRecord_.read();
+    if (record->state_ == State::OK) {
+      emgcyController = record->emgcyController_;
+    }
+  }
+
+  if (emgcyController != standbyEmgcyController_) {
+    if (standbyController_ != nullptr) {
+      standbyController_->leaveHotStandby();
+      MELO_DEBUG_STREAM("[Rocoma][" << standbyEmgcyController_->getControllerName() << "] Left hot standby.");
+    }
+    standbyController_ = nullptr;
+    standbyEmgcyController_ = nullptr;
+
+    // The emergency controller could be being stopped after a previous emergency stop (retry on the next tick)
+    if (emgcyController != nullptr && !emgcyController->isBeingStopped()) {
+      standbyEmgcyController_ = emgcyController;
+      auto hotStandbyController = dynamic_cast<HotStandbyInterface*>(emgcyController);
+      if (hotStandbyController == nullptr) {
+        MELO_DEBUG_STREAM("[Rocoma][" << emgcyController->getControllerName() << "] Does not support hot standby.");
+      } else if (hotStandbyController->enterHotStandby(options_.timeStep)) {
+        standbyController_ = hotStandbyController;
+        MELO_DEBUG_STREAM("[Rocoma][" << emgcyController->getControllerName() << "] Entered hot standby.");
+      }
+    }
+  }
+
+  if (standbyController_ != nullptr) {
+    standbyController_->advanceInHotStandby(options_.timeStep);
+  }
+
+  // An emergency stop during this tick hands the emergency controller over now
+  completeHotStandbyHandOver();
+  isHotStandbyTicking_ = false;
+  return true;
+}
+
+bool ControllerManager::takeOverFromHotStandby(roco::EmergencyControllerAdapterInterface* emgcyController) {
+  if (standbyController_ == nullptr || emgcyController != standbyEmgcyController_) {
+    return false;
+  }
+  const bool tookOver = standbyController_->takeOverFromHotStandby();
+  standbyController_ = nullptr;
+  standbyEmgcyController_ = nullptr;
+  return tookOver;
+}
+
+void ControllerManager::completeHotStandbyHandOver() {
+  roco::EmergencyControllerAdapterInterface* emgcyController = hotStandbyHandOver_.load(std::memory_order_acquire);
+  if (emgcyController == nullptr) {
+    return;
+  }
+
+  // The emergency stop only tries to lock the hot standby, blocking on it here can not deadlock
+  std::lock_guard<std::mutex> lockEmergencyStop(emergencyStopMutex_);
+  bool isEmergencyControllerActive = false;
+  {
+    RcuCell<DispatchRecord>::ReadGuard record = dispatchRecord_.read();
+    isEmergencyControllerActive = record->state_ == State::EMERGENCY && record->emgcyController_ == emgcyController;
+  }
+
+  // Take over the last command computed in shadow, otherwise fast initialize (the controller is free now). If both fail, the next
+  // advance fails and escalates to the failproof controller.
+  if (isEmergencyControllerActive) {
+    if (takeOverFromHotStandby(emgcyController) || emgcyController->initializeControllerFast(options_.timeStep)) {
+      emgcyController->setIsRunning(true);
+      if (hotStandbyHandOverStart_ != TimingClock::time_point()) {
+        emergencyStopLatency_.record(nanosecondsSince(hotStandbyHandOverStart_), 0u);
+      }
+      MELO_DEBUG_STREAM("[Rocoma][" << emgcyController->getControllerName() << "] Handed over from hot standby.");
+    } else {
+      MELO_WARN_STREAM("[Rocoma][" << emgcyController->getControllerName() << "] Could not be handed over from hot standby!");
+    }
+  }
+
+  // Otherwise a later emergency stop moved on to the failproof controller, the controller is stopped against the scratch command
+  if (standbyController_ != nullptr) {
+    standbyController_->leaveHotStandby();
+    standbyController_ = nullptr;
+    standbyEmgcyController_ = nullptr;
+  }
+  hotStandbyHandOverStart_ = TimingClock::time_point();
+  hotStandbyHandOver_.store(nullptr, std::memory_order_release);
+}
+
+bool ControllerManager::attachShadowController(const std::string& controllerName) {
+  // Switching must not promote the controller while it is attached
+  std::lock_guard<std::mutex> lockSwitchController(switchControllerMutex_);
+
+  ControllerPtr* controller = controllers_.find(controllerName);
+  if (controller == nullptr) {
+    MELO_WARN_STREAM("[Rocoma][" << controllerName << "] Can not run in shadow, controller does not exist!");
+    return false;
+  }
+  roco::ControllerAdapterInterface* shadowController = controller->get();
+  {
+    boost::shared_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+    if (state_ == State::OK && activeControllerPair_.controller_ == shadowController) {
+      MELO_WARN_STREAM("[Rocoma][" << controllerName << "] Can not run in shadow, controller is active!");
+      return false;
+    }
+  }
+  auto shadowInterface = dynamic_cast<ShadowInterface*>(shadowController);
+  if (shadowInterface == nullptr) {
+    MELO_WARN_STREAM("[Rocoma][" << controllerName << "] Can not run in shadow, controller does not support it!");
+    return false;
+  }
+  if (!waitUntilControllerStopped(shadowController) || !ensureControllerCreated(shadowController)) {
+    return false;
+  }
+
+  detachShadowController();
+  std::lock_guard<std::mutex> lockAttach(shadowAttachMutex_);
+  {
+    std::lock_guard<std::mutex> lockShadow(shadowMutex_);
+    if (!shadowInterface->enterShadow(options_.timeStep)) {
+      return false;
+    }
+    shadowController_ = shadowController;
+    shadowInterface_ = shadowInterface;
+    shadowReport_ = ShadowReport();
+    shadowReport_.controllerName_ = controllerName;
+    shadowReport_.hasCommandDivergence_ = shadowInterface->hasCommandDivergence();
+    shadowTiming_.reset();
+    shadowCommandDivergenceSum_ = 0.0;
+    lastShadowTick_ = tickCount_;
+  }
+  shadowSnapshotSource_.publish(shadowInterface);
+  isShadowAttached_.store(true, std::memory_order_relaxed);
+
+  shadowDriver_.reset(new TickDriver([this]() { return advanceShadow(); }, options_.timeStep, options_.shadowTickDriverOptions));
+  if (!shadowDriver_->start()) {
+    MELO_WARN_STREAM("[Rocoma][" << controllerName << "] Could not start the shadow thread!");
+  }
+  return true;
+}
+
+bool ControllerManager::detachShadowController() {
+  std::lock_guard<std::mutex> lockAttach(shadowAttachMutex_);
+  if (shadowDriver_ != nullptr) {
+    shadowDriver_->stop();
+    shadowDriver_.reset();
+  }
+  // After the grace period the tick thread no longer publishes snapshots
+  isShadowAttached_.store(false, std::memory_order_relaxed);
+  shadowSnapshotSource_.publish(nullptr);
+
+  std::lock_guard<std::mutex> lockShadow(shadowMutex_);
+  if (shadowInterface_ == nullptr) {
+    return false;
+  }
+  shadowInterface_->leaveShadow();
+  shadowController_ = nullptr;
+  shadowInterface_ = nullptr;
+  return true;
+}
+
+bool ControllerManager::getShadowReport(ShadowReport& report) const {
+  std::lock_guard<std::mutex> lockShadow(shadowMutex_);
+  if (shadowInterface_ == nullptr) {
+    return false;
+  }
+  report = shadowReport_;
+  report.advance_ = shadowTiming_.getStatistics();
+  const std::uint64_t numSuccessfulTicks = shadowReport_.numTicks_ - shadowReport_.numFailedTicks_;
+  report.meanCommandDivergence_ = numSuccessfulTicks > 0u ? shadowCommandDivergenceSum_ / static_cast<double>(numSuccessfulTicks) : 0.0;
+  return true;
+}
+
+bool ControllerManager::advanceShadow() {
+  // Only follow the ticks, updateController does not wait for or signal the shadow thread
+  const std::uint64_t tick = tickCount_;
+  std::lock_guard<std::mutex> lockShadow(shadowMutex_);
+  if (shadowInterface_ == nullptr || tick == lastShadowTick_) {
+    return true;
+  }
+  lastShadowTick_ = tick;
+
+  bool success = false;
+  {
+    ScopedTiming timing(&shadowTiming_, toNanoseconds(options_.timeStep));
+    success = shadowInterface_->advanceInShadow(options_.timeStep);
+  }
+  ++shadowReport_.numTicks_;
+  if (!success) {
+    ++shadowReport_.numFailedTicks_;
+    return true;
+  }
+  const double commandDivergence = shadowInterface_->getCommandDivergence();
+  shadowReport_.lastCommandDivergence_ = commandDivergence;
+  shadowReport_.maxCommandDivergence_ = std::max(shadowReport_.maxCommandDivergence_, commandDivergence);
+  shadowCommandDivergenceSum_ += commandDivergence;
+  return true;
+}
+
+void ControllerManager::startCreateAhead() {
+  if (!options_.lazyControllerCreation || !options_.createAheadInBackground || createAheadThread_.joinable()) {
+    return;
+  }
+  isStoppingCreateAhead_ = false;
+  createAheadThread_ = std::thread(&ControllerManager::createAhead, this);
+}
+
+void ControllerManager::addListener(Listener* listener) {
+  if (listener == nullptr) {
+    return;
+  }
+  std::lock_guard<std::recursive_mutex> lockListeners(listenerMutex_);
+  if (std::find(listeners_.begin(), listeners_.end(), listener) == listeners_.end()) {
+    listeners_.push_back(listener);
+  }
+}
+
+void ControllerManager::removeListener(Listener* listener) {
+  std::lock_guard<std::recursive_mutex> lockListeners(listenerMutex_);
+  listeners_.erase(std::remove(listeners_.begin(), listeners_.end(), listener), listeners_.end());
+}
+
+void ControllerManager::postEmergencyStopNotification(EmergencyStopType type) {
+  Notification notification;
+  notification.type_ = Notification::Type::EMERGENCY_STOP;
+  notification.emergencyStopType_ = type;
+  postNotification(notification);
+}
+
+void ControllerManager::postControllerChangedNotification(const std::string& newControllerName) {
+  Notification notification;
+  notification.type_ = Notification::Type::CONTROLLER_CHANGED;
+  notification.controllerName_ = &newControllerName;
+  postNotification(notification);
+}
+
+void ControllerManager::postStateChangedNotification(State state, bool clearedEmergencyStop) {
+  Notification notification;
+  notification.type_ = Notification::Type::STATE_CHANGED;
+  notification.state_ = state;
+  notification.clearedEmergencyStop_ = clearedEmergencyStop;
+  postNotification(notification);
+}
+
+void ControllerManager::postNotification(const Notification& notification) {
+  // Never deliver on the calling thread (possibly the tick thread) while the notifier thread is running
+  numPostingNotifications_.fetch_add(1u);
+  if (isNotifierRunning_.load()) {
+    if (!notifications_.tryPush(notification)) {
+      if (notification.type_ == Notification::Type::EMERGENCY_STOP) {
+        pendingEmergencyStopType_.store(notification.emergencyStopType_, std::memory_order_relaxed);
+        isEmergencyStopPending_.store(true, std::memory_order_release);
+      } else {
+        numDroppedNotifications_.fetch_add(1u, std::memory_order_relaxed);
+      }
+    }
+    numPostingNotifications_.fetch_sub(1u, std::memory_order_release);
+    notificationPosted_.post();
+    return;
+  }
+  numPostingNotifications_.fetch_sub(1u, std::memory_order_release);
+  std::lock_guard<std::recursive_mutex> lockListeners(listenerMutex_);
+  dispatchNotification(notification);
+}
+
+void ControllerManager::dispatchNotification(const Notification& notification) {
+  switch (notification.type_) {
+    case Notification::Type::EMERGENCY_STOP: {
+      this->notifyEmergencyStop(notification.emergencyStopType_);
+      for (auto listener : listeners_) {
+        listener->onEmergencyStop(notification.emergencyStopType_);
+      }
+      break;
+    }
+    case Notification::Type::CONTROLLER_CHANGED: {
+      this->notifyControllerChanged(*notification.controllerName_);
+      for (auto listener : listeners_) {
+        listener->onControllerChanged(*notification.controllerName_);
+      }
+      break;
+    }
+    case Notification::Type::STATE_CHANGED: {
+      this->notifyControllerManagerStateChanged(notification.state_, notification.clearedEmergencyStop_);
+      for (auto listener : listeners_) {
+        listener->onControllerManagerStateChanged(notification.state_, notification.clearedEmergencyStop_);
+      }
+      break;
+    }
+  }
+}
+
+void ControllerManager::deliverNotifications() {
+  Notification notification;
+  while (notifications_.tryPop(notification)) {
+    dispatchNotification(notification);
+  }
+  if (isEmergencyStopPending_.exchange(false, std::memory_order_acquire)) {
+    notification.type_ = Notification::Type::EMERGENCY_STOP;
+    notification.emergencyStopType_ = pendingEmergencyStopType_.load(std::memory_order_relaxed);
+    dispatchNotification(notification);
+  }
+}
+
+void ControllerManager::startNotifier() {
+  if (!options_.asyncNotifications || notifierThread_.joinable()) {
+    return;
+  }
+  isStoppingNotifier_ = false;
+  notifierThread_ = std::thread(&ControllerManager::runNotifier, this);
+  isNotifierRunning_ = true;
+}
+
+void ControllerManager::stopNotifier() {
+  // Posts that saw the notifier running enqueue before the last delivery
+  isNotifierRunning_ = false;
+  while (numPostingNotifications_.load(std::memory_order_acquire) != 0u) {
+    std::this_thread::yield();
+  }
+  if (notifierThread_.joinable()) {
+    isStoppingNotifier_ = true;
+    notificationPosted_.post();
+    notifierThread_.join();
+  }
+
+  // Deliver what the notifier thread left
+  std::lock_guard<std::recursive_mutex> lockListeners(listenerMutex_);
+  deliverNotifications();
+}
+
+void ControllerManager::runNotifier() {
+  while (true) {
+    notificationPosted_.wait();
+    if (isStoppingNotifier_) {
+      return;
+    }
+    std::lock_guard<std::recursive_mutex> lockListeners(listenerMutex_);
+    deliverNotifications();
+  }
+}
+
+void ControllerManager::stopCreateAhead() {
+  {
+    std::lock_guard<std::mutex> lockCreation(creationMutex_);
+    isStoppingCreateAhead_ = true;
+  }
+  creationChanged_.notify_all();
+  if (createAheadThread_.joinable()) {
+    createAheadThread_.join();
+  }
+}
+
+void ControllerManager::createAhead() {
+  // Only use otherwise idle cycles, creation must not delay the tick
+  sched_param params{};
+  params.sched_priority = 0;
+  if (pthread_setschedparam(pthread_self(), SCHED_IDLE, &params) != 0) {
+    MELO_WARN("[Rocoma] Could not set idle priority for creating controllers ahead.");
+  }
+
+  std::unique_lock<std::mutex> lockCreation(creationMutex_);
+  while (true) {
+    creationChanged_.wait(lockCreation, [this]() { return isStoppingCreateAhead_ || !uncreatedControllers_.empty(); });
+    if (isStoppingCreateAhead_) {
+      return;
+    }
+    roco::ControllerAdapterInterface* controller = uncreatedControllers_.front();
+    uncreatedControllers_.erase(uncreatedControllers_.begin());
+    createLazily(controller, lockCreation);
+  }
+}
+
+void ControllerManager::registerUncreatedController(roco::ControllerAdapterInterface* controller) {
+  {
+    std::lock_guard<std::mutex> lockCreation(creationMutex_);
+    uncreatedControllers_.push_back(controller);
+    ++lazyCreationReport_.numRegisteredControllers_;
+  }
+  creationChanged_.notify_all();
+  MELO_DEBUG_STREAM("[Rocoma][" << controller->getControllerName() << "] Deferred creation to the first switch.");
+}
+
+bool ControllerManager::ensureControllerCreated(roco::ControllerAdapterInterface* controller) {
+  if (!options_.lazyControllerCreation) {
+    return true;
+  }
+
+  std::unique_lock<std::mutex> lockCreation(creationMutex_);
+  // The create ahead thread could be creating the controller at the moment (wait for completion)
+  creationChanged_.wait(lockCreation, [this, controller]() { return controllersInCreation_.count(controller) == 0u; });
+
+  auto uncreatedController = std::find(uncreatedControllers_.begin(), uncreatedControllers_.end(), controller);
+  if (uncreatedController != uncreatedControllers_.end()) {
+    uncreatedControllers_.erase(uncreatedController);
+  } else if (failedControllers_.erase(controller) == 0u) {
+    return true;
+  }
+  return createLazily(controller, lockCreation);
+}
+
+bool ControllerManager::createLazily(roco::ControllerAdapterInterface* controller, std::unique_lock<std::mutex>& lock) {
+  controllersInCreation_.insert(controller);
+  lock.unlock();
+
+  const std::int64_t residentMemoryBefore = getResidentMemory();
+  const TimingClock::time_point start = TimingClock::now();
+  const bool success = controller->createController(options_.timeStep);
+  const double createTime = static_cast<double>(nanosecondsSince(start)) * 1.0e-9;
+  const std::int64_t residentMemory = getResidentMemory() - residentMemoryBefore;
+
+  lock.lock();
+  controllersInCreation_.erase(controller);
+  if (success) {
+    ++lazyCreationReport_.numCreatedControllers_;
+    lazyCreationReport_.createTime_ += createTime;
+    lazyCreationReport_.residentMemory_ += residentMemory;
+    MELO_INFO_STREAM("[Rocoma][" << controller->getControllerName() << "] Created controller in " << createTime << " s.");
+  } else {
+    failedControllers_.insert(controller);
+    MELO_ERROR_STREAM("[Rocoma][" << controller->getControllerName() << "] Could not create controller!");
+  }
+  creationChanged_.notify_all();
+  return success;
+}
+
 bool ControllerManager::switchFromOldToNewController(roco::ControllerAdapterInterface* oldController,
                                                      roco::ControllerAdapterInterface* newController, State previousState,
                                                      std::promise<SwitchResponse>& response_promise) {
+  if (options_.makeBeforeBreakSwitch) {
+    return makeBeforeBreakSwitch(oldController, newController, previousState, response_promise);
+  }
+
+  /** NOTE:
+   * 1. newController is not running (we would have returned in switchController already)
+   * 2. newController can not be an emergency controller of the currently running controller
+   * 3. newController could be being stopped by a different thread at the moment (wait for completion)
+   */
+  if (!waitUntilControllerStopped(newController)) {
+    response_promise.set_value(SwitchResponse::ERROR);
+    return false;
+  }
+
   /** NOTE:
    * 1. The active controller is not blocked -> by definition there can be no data races between advance and preStop
    */
@@ -578,18 +1883,6 @@ bool ControllerManager::switchFromOldToNewController(roco::ControllerAdapterInte
     signal_logger::logger->stopAndSaveLoggerData(options_.loggerOptions.fileTypes);
   }
 
-  /** NOTE:
-   * 1. newController is not running (we would have returned in switchController already)
-   * 2. newController can not be an emergency controller of the currently running controller
-   * 3. newController could be being stopped by a different thread at the moment (wait for completion)
-   */
-  if (newController->isBeingStopped()) {
-    MELO_WARN_STREAM("[Rocoma][" << newController->getControllerName()
-                                 << "] Controller is currently being stopped. Wait for completion before switching.")
-  }
-  while (newController->isBeingStopped()) {
-  }
-
   //! initialize new controller
   roco::ControllerSwapStateInterfacePtr state(nullptr);
   if (oldController != nullptr) {
@@ -625,6 +1918,7 @@ bool ControllerManager::switchFromOldToNewController(roco::ControllerAdapterInte
 
   // Set the newController as active controller as soon as the controller is initialized
   if (newController->isControllerInitialized()) {
+    std::size_t retiredDispatchSlot = RcuCell<DispatchRecord>::noSlot_;
     {
       //! This step has to be done when no update nor emergency stop is performed
       boost::unique_lock<boost::shared_mutex> lockControllers(controllerMutex_);
@@ -634,9 +1928,10 @@ bool ControllerManager::switchFromOldToNewController(roco::ControllerAdapterInte
           oldController->setIsRunning(false);
         }
         newController->setIsRunning(true);
-        activeControllerPair_ = controllerPairs_.at(newController->getControllerName());
+        activeControllerPair_ = controllerPairs_[controllers_.getId(newController->getControllerName())];
         state_ = State::OK;
-        MELO_INFO("[Rocoma] Switched to controller %s", activeControllerPair_.controllerName_.c_str());
+        retiredDispatchSlot = publishDispatchRecord();
+        MELO_INFO("[Rocoma] Switched to controller %s", activeControllerPair_.controllerName_->c_str());
       } else {
         lockControllers.unlock();
         MELO_ERROR_STREAM("[Rocoma][" << newController->getControllerName() << "] Could not switch. Emergency stop detected.");
@@ -654,9 +1949,10 @@ bool ControllerManager::switchFromOldToNewController(roco::ControllerAdapterInte
         return false;
       }
     }
+    dispatchRecord_.waitForReaders(retiredDispatchSlot);
 
-    this->notifyControllerChanged(activeControllerPair_.controllerName_);
-    this->notifyControllerManagerStateChanged(State::OK, clearedEmergencyStop_);
+    this->postControllerChangedNotification(*activeControllerPair_.controllerName_);
+    this->postStateChangedNotification(State::OK, clearedEmergencyStop_);
 
     // stop old controller
     if (oldController != nullptr) {
@@ -682,6 +1978,320 @@ bool ControllerManager::switchFromOldToNewController(roco::ControllerAdapterInte
   }
 }
 
+bool ControllerManager::makeBeforeBreakSwitch(roco::ControllerAdapterInterface* oldController,
+                                              roco::ControllerAdapterInterface* newController, State previousState,
+                                              std::promise<SwitchResponse>& response_promise) {
+  /** NOTE:
+   * 1. The old controller keeps advancing until the cutover, it is only stopped after the new controller took over
+   * 2. The swap state of the old controller is taken by the tick thread between two of its advances
+   * 3. The logger is restarted at the cutover, the old controller logs until its last tick
+   */
+  if (!waitUntilControllerStopped(newController)) {
+    response_promise.set_value(SwitchResponse::ERROR);
+    return false;
+  }
+
+  //! initialize new controller
+  roco::ControllerSwapStateInterfacePtr state(nullptr);
+  if (oldController != nullptr) {
+    getControllerSwapStateBetweenTicks(oldController, state);
+  }
+  const bool swapped = newController->swapController(options_.timeStep, state) && newController->isControllerInitialized();
+
+  // The old controller is still running, no emergency stop required
+  if (!swapped) {
+    newController->preStopController();
+    newController->stopController();
+    MELO_ERROR_STREAM("[Rocoma][" << newController->getControllerName() << "] Could not swap. Keep running the active controller.");
+    response_promise.set_value(SwitchResponse::ERROR);
+    return false;
+  }
+
+  // Cutover between two ticks
+  std::uint64_t cutoverTick = 0u;
+  std::size_t retiredDispatchSlot = RcuCell<DispatchRecord>::noSlot_;
+  {
+    //! This step has to be done when no update nor emergency stop is performed
+    boost::unique_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+    if (state_ != previousState) {
+      lockControllers.unlock();
+      // The emergency stop stopped the old controller
+      MELO_ERROR_STREAM("[Rocoma][" << newController->getControllerName() << "] Could not switch. Emergency stop detected.");
+      newController->preStopController();
+      newController->stopController();
+      response_promise.set_value(SwitchResponse::ERROR);
+      return false;
+    }
+
+    // The logger restarts with the new controller, the old controller logged until its last tick
+    if (options_.loggerOptions.enable && signal_logger::logger->isRunning()) {
+      signal_logger::logger->stopAndSaveLoggerData(options_.loggerOptions.fileTypes);
+    }
+
+    if (oldController != nullptr) {
+      oldController->setIsRunning(false);
+    }
+    newController->setIsRunning(true);
+    activeControllerPair_ = controllerPairs_[controllers_.getId(newController->getControllerName())];
+    state_ = State::OK;
+    retiredDispatchSlot = publishDispatchRecord();
+    cutoverTick = tickCount_.load(std::memory_order_acquire);
+
+    if (options_.loggerOptions.enable) {
+      signal_logger::logger->startLogger(options_.loggerOptions.updateOnStart);
+    }
+    MELO_INFO("[Rocoma] Switched to controller %s", activeControllerPair_.controllerName_->c_str());
+  }
+  dispatchRecord_.waitForReaders(retiredDispatchSlot);
+
+  this->postControllerChangedNotification(*activeControllerPair_.controllerName_);
+  this->postStateChangedNotification(State::OK, clearedEmergencyStop_);
+
+  // Stop the old controller once the new one produced its first command
+  if (oldController != nullptr) {
+    if (!waitForTickAfter(cutoverTick, 10.0 * options_.timeStep)) {
+      MELO_DEBUG_STREAM("[Rocoma][" << newController->getControllerName() << "] No tick after cutover. Stopping old controller anyway.");
+    }
+    this->stopController(oldController);
+  }
+
+  response_promise.set_value(SwitchResponse::SWITCHING);
+  return true;
+}
+
+bool ControllerManager::waitForTickAfter(std::uint64_t tick, double timeout) const {
+  return waitForTick([this, tick]() { return tickCount_.load(std::memory_order_acquire) > tick; }, timeout);
+}
+
+bool ControllerManager::waitForTick(const std::function<bool()>& condition, double timeout) const {
+  // Registered before checking the condition, a tick after the check posts the semaphore
+  ++numTickWaiters_;
+  const TimingClock::time_point deadline = TimingClock::now() + std::chrono::nanoseconds(toNanoseconds(timeout));
+  bool isFulfilled = condition();
+  while (!isFulfilled) {
+    const double remainingTime = std::chrono::duration<double>(deadline - TimingClock::now()).count();
+    if (remainingTime <= 0.0 || !tickPosted_.waitFor(remainingTime)) {
+      isFulfilled = condition();
+      break;
+    }
+    isFulfilled = condition();
+  }
+  --numTickWaiters_;
+  return isFulfilled;
+}
+
+void ControllerManager::getControllerSwapStateBetweenTicks(roco::ControllerAdapterInterface* controller,
+                                                           roco::ControllerSwapStateInterfacePtr& swapState) {
+  swapState_.reset();
+  swapStateController_.store(controller, std::memory_order_relaxed);
+  swapStateRequest_.store(SwapStateRequest::REQUESTED, std::memory_order_release);
+  waitForTick([this]() { return swapStateRequest_.load(std::memory_order_acquire) == SwapStateRequest::TAKEN; },
+              10.0 * options_.timeStep);
+
+  // Withdraw the request, unless the tick thread is taking the swap state
+  SwapStateRequest request = SwapStateRequest::REQUESTED;
+  if (swapStateRequest_.compare_exchange_strong(request, SwapStateRequest::NONE)) {
+    boost::unique_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+    controller->getControllerSwapState(swapState);
+    return;
+  }
+  while (swapStateRequest_.load(std::memory_order_acquire) != SwapStateRequest::TAKEN) {
+    std::this_thread::yield();
+  }
+  swapState = std::move(swapState_);
+  swapStateRequest_.store(SwapStateRequest::NONE, std::memory_order_release);
+}
+
+void ControllerManager::takeRequestedSwapState(roco::ControllerAdapterInterface* controller) {
+  SwapStateRequest request = SwapStateRequest::REQUESTED;
+  if (swapStateController_.load(std::memory_order_relaxed) != controller ||
+      !swapStateRequest_.compare_exchange_strong(request, SwapStateRequest::TAKING)) {
+    return;
+  }
+  controller->getControllerSwapState(swapState_);
+  swapStateRequest_.store(SwapStateRequest::TAKEN, std::memory_order_release);
+}
+
+std::size_t ControllerManager::publishDispatchRecord() {
+  const std::size_t retiredSlot = dispatchRecord_.exchange(makeDispatchRecord());
+  publishStatus();
+  return retiredSlot;
+}
+
+void ControllerManager::publishStatus() {
+  static const std::string notAvailableName("Not available");
+
+  std::lock_guard<std::mutex> lockStatus(statusMutex_);
+  Status status;
+  status.version_ = publishedStatus_.version_ + 1u;
+  status.state_ = state_;
+  status.activeControllerId_ = activeControllerPair_.controllerId_;
+  switch (state_) {
+    case State::OK: {
+      status.activeControllerName_ = activeControllerPair_.controllerName_;
+      break;
+    }
+    case State::EMERGENCY: {
+      status.activeControllerName_ = activeControllerPair_.emgcyControllerName_;
+      break;
+    }
+    case State::FAILURE: {
+      status.activeControllerName_ = &failproofControllerName_;
+      break;
+    }
+    case State::NA: {
+      status.activeControllerName_ = &notAvailableName;
+      break;
+    }
+  }
+  status.clearedEmergencyStop_ = clearedEmergencyStop_;
+  const bool isSwitch = status.state_ != publishedStatus_.state_ || status.activeControllerName_ != publishedStatus_.activeControllerName_;
+  status.lastSwitchTime_ = isSwitch ? std::chrono::duration_cast<std::chrono::nanoseconds>(TimingClock::now().time_since_epoch()).count()
+                                    : publishedStatus_.lastSwitchTime_;
+  status_.store(status);
+  publishedStatus_ = status;
+}
+
+ControllerManager::DispatchRecord ControllerManager::makeDispatchRecord() const {
+  DispatchRecord record;
+  record.state_ = state_;
+  record.controller_ = activeControllerPair_.controller_;
+  record.emgcyController_ = activeControllerPair_.emgcyController_;
+  record.controllerMonitor_ = activeControllerPair_.controllerMonitor_;
+  record.emgcyControllerMonitor_ = activeControllerPair_.emgcyControllerMonitor_;
+  return record;
+}
+
+ControllerManager::ControllerSetPtr ControllerManager::makeControllerSet(ControllerId controllerId, ControllerId emgcyControllerId) {
+  ControllerSetPtr controllerSet(controllers_[controllerId].get(), nullptr);
+  controllerSet.controllerId_ = controllerId;
+  controllerSet.controllerName_ = &controllers_.getName(controllerId);
+  auto controllerMonitor = controllerMonitors_.find(*controllerSet.controllerName_);
+  controllerSet.controllerMonitor_ = controllerMonitor != controllerMonitors_.end() ? controllerMonitor->second.get() : nullptr;
+  if (emgcyControllerId != invalidControllerId) {
+    controllerSet.emgcyController_ = emergencyControllers_[emgcyControllerId].get();
+    controllerSet.emgcyControllerName_ = &emergencyControllers_.getName(emgcyControllerId);
+    auto emgcyControllerMonitor = controllerMonitors_.find(*controllerSet.emgcyControllerName_);
+    controllerSet.emgcyControllerMonitor_ =
+        emgcyControllerMonitor != controllerMonitors_.end() ? emgcyControllerMonitor->second.get() : nullptr;
+  }
+  return controllerSet;
+}
+
+void ControllerManager::addControllerSet(ControllerId controllerId, ControllerId emgcyControllerId) {
+  boost::unique_lock<boost::shared_mutex> lockControllers(controllerMutex_);
+  controllerPairs_.push_back(makeControllerSet(controllerId, emgcyControllerId));
+}
+
+void ControllerManager::setupControllerMonitor(roco::ControllerAdapterInterface* controller) {
+  auto extension = dynamic_cast<ControllerAdapterExtensionInterface*>(controller);
+  if (extension != nullptr) {
+    extension->setIsCollectingTimings(options_.collectTimingStatistics);
+  }
+  std::lock_guard<std::mutex> lockRegistration(registrationMutex_);
+  std::unique_ptr<ControllerMonitor>& monitor = controllerMonitors_[controller->getControllerName()];
+  if (monitor == nullptr) {
+    monitor.reset(new ControllerMonitor());
+  }
+  monitor->budget_ = getControllerBudget(controller->getControllerName());
+}
+
+LatencyStatistics ControllerManager::getUpdateControllerTimingStatistics() const {
+  return updateControllerTiming_.getStatistics();
+}
+
+bool ControllerManager::getControllerTimingReport(const std::string& controllerName, ControllerTimingReport& report) const {
+  report = ControllerTimingReport();
+
+  // Failproof controller has no phases
+  if (failproofController_ != nullptr && controllerName == failproofController_->getControllerName()) {
+    report.advanceController_ = failproofControllerMonitor_.timing_.getStatistics();
+    return true;
+  }
+
+  std::lock_guard<std::mutex> lockRegistration(registrationMutex_);
+  auto monitor = controllerMonitors_.find(controllerName);
+  if (monitor == controllerMonitors_.end()) {
+    return false;
+  }
+  report.advanceController_ = monitor->second->timing_.getStatistics();
+
+  // Phase timings are provided by rocoma adapters
+  const roco::ControllerAdapterInterface* controller = nullptr;
+  const ControllerPtr* controllerIt = controllers_.find(controllerName);
+  if (controllerIt != nullptr) {
+    controller = controllerIt->get();
+  } else {
+    const EmgcyControllerPtr* emgcyControllerIt = emergencyControllers_.find(controllerName);
+    if (emgcyControllerIt != nullptr) {
+      controller = emgcyControllerIt->get();
+    }
+  }
+  auto extension = dynamic_cast<const ControllerAdapterExtensionInterface*>(controller);
+  if (extension != nullptr && extension->isCollectingTimings()) {
+    const ControllerTimings& timings = extension->getControllerTimings();
+    report.hasPhaseTimings_ = true;
+    report.updateState_ = timings.updateState_.getStatistics();
+    report.advance_ = timings.advance_.getStatistics();
+    report.updateCommand_ = timings.updateCommand_.getStatistics();
+  }
+
+  return true;
+}
+
+ControllerManagerStatistics ControllerManager::getStatistics() const {
+  ControllerManagerStatistics statistics;
+  statistics.tickCount_ = tickCount_.load(std::memory_order_acquire);
+  statistics.updateController_ = updateControllerTiming_.getStatistics();
+  statistics.updateControllerLockWait_ = updateControllerLockWait_.getStatistics();
+  statistics.switchController_ = switchControllerTiming_.getStatistics();
+  statistics.emergencyStop_ = emergencyStopLatency_.getStatistics();
+
+  // The counters are read without locks, the registration lock keeps the registries and monitors from changing (never taken on the tick)
+  std::lock_guard<std::mutex> lockRegistration(registrationMutex_);
+  const auto addController = [&statistics](const std::string& controllerName, const ControllerMonitor& monitor) {
+    ControllerStatistics controllerStatistics;
+    controllerStatistics.controllerName_ = controllerName;
+    controllerStatistics.numTicks_ = monitor.numTicks_.load(std::memory_order_relaxed);
+    controllerStatistics.advanceController_ = monitor.timing_.getStatistics();
+    statistics.controllers_.push_back(controllerStatistics);
+  };
+  statistics.controllers_.reserve(controllers_.size() + emergencyControllers_.size() + 1u);
+  for (ControllerId id = 0u; id < controllers_.size(); ++id) {
+    auto monitor = controllerMonitors_.find(controllers_.getName(id));
+    if (monitor != controllerMonitors_.end()) {
+      addController(monitor->first, *monitor->second);
+    }
+  }
+  for (ControllerId id = 0u; id < emergencyControllers_.size(); ++id) {
+    auto monitor = controllerMonitors_.find(emergencyControllers_.getName(id));
+    if (monitor != controllerMonitors_.end()) {
+      addController(monitor->first, *monitor->second);
+    }
+  }
+  if (failproofController_ != nullptr) {
+    addController(failproofController_->getControllerName(), failproofControllerMonitor_);
+  }
+
+  return statistics;
+}
+
+bool ControllerManager::getControllerAllocationStatistics(const std::string& controllerName, AllocationStatistics& statistics) const {
+  if (failproofController_ != nullptr && controllerName == failproofController_->getControllerName()) {
+    statistics = failproofControllerMonitor_.allocations_.getStatistics();
+    return true;
+  }
+
+  std::lock_guard<std::mutex> lockRegistration(registrationMutex_);
+  auto monitor = controllerMonitors_.find(controllerName);
+  if (monitor == controllerMonitors_.end()) {
+    statistics = AllocationStatistics();
+    return false;
+  }
+  statistics = monitor->second->allocations_.getStatistics();
+  return true;
+}
+
 bool ControllerManager::addSharedModule(roco::SharedModulePtr&& sharedModule) {
   std::string name = sharedModule->getName();
 
@@ -0,0 +1,107 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     AllocationInterposer.cpp
+ * @date     Oct, 2026
+ * @brief    Replaces the glibc allocation functions to count allocations (see AllocationTracker). Always linked into
+ *           test_rocoma_allocations, linked into the benchmarks with -DROCOMA_TRACK_ALLOCATIONS=ON, never into the library.
+ */
+
+// rocoma
+#include "rocoma/common/AllocationTracker.hpp"
+
+// STL
+#include <cerrno>
+#include <cstddef>
+
+// operator new and the C++ runtime allocate through these functions
+extern "C" {
+
+void* __libc_malloc(std::size_t size);                           // NOLINT(bugprone-reserved-identifier)
+void* __libc_calloc(std::size_t count, std::size_t size);        // NOLINT(bugprone-reserved-identifier)
+void* __libc_realloc(void* pointer, std::size_t size);           // NOLINT(bugprone-reserved-identifier)
+void* __libc_memalign(std::size_t alignment, std::size_t size);  // NOLINT(bugprone-reserved-identifier)
+
+void* malloc(std::size_t size) {
+  rocoma::AllocationTracker::recordAllocation();
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t count, std::size_t size) {
+  rocoma::AllocationTracker::recordAllocation();
+  return __libc_calloc(count, size);
+}
+
+void* realloc(void* pointer, std::size_t size) {
+  rocoma::AllocationTracker::recordAllocation();
+  return __libc_realloc(pointer, size);
+}
+
+void* memalign(std::size_t alignment, std::size_t size) {
+  rocoma::AllocationTracker::recordAllocation();
+  return __libc_memalign(alignment, size);
+}
+
+void* aligned_alloc(std::size_t alignment, std::size_t size) {
+  rocoma::AllocationTracker::recordAllocation();
+  return __libc_memalign(alignment, size);
+}
+
+int posix_memalign(void** pointer, std::size_t alignment, std::size_t size) {
+  // Power of two multiple of sizeof(void*), __libc_memalign would round up an invalid alignment
+  if (alignment < sizeof(void*) || (alignment & (alignment - 1u)) != 0u) {
+    return EINVAL;
+  }
+  rocoma::AllocationTracker::recordAllocation();
+  void* memory = __libc_memalign(alignment, size);
+  if (memory == nullptr) {
+    return ENOMEM;
+  }
+  *pointer = memory;
+  return 0;
+}
+
+}  // extern "C"
+
+namespace {
+
+//! Marks the tracker available on startup
+struct InterposerRegistration {
+  InterposerRegistration() { rocoma::AllocationTracker::setAvailable(); }
+};
+
+const InterposerRegistration interposerRegistration;
+
+}  // namespace
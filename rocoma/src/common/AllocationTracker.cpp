@@ -0,0 +1,81 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     AllocationTracker.cpp
+ * @date     Oct, 2026
+ */
+
+// rocoma
+#include "rocoma/common/AllocationTracker.hpp"
+
+// STL
+#include <cstdlib>
+
+namespace rocoma {
+
+namespace {
+
+// Trivially constructed, accessing them does not allocate
+thread_local std::uint64_t threadAllocations = 0u;
+thread_local bool isAbortingOnAllocation = false;
+std::atomic_bool isInterposerLinked{false};
+
+}  // namespace
+
+bool AllocationTracker::isAvailable() {
+  return isInterposerLinked.load(std::memory_order_relaxed);
+}
+
+std::uint64_t AllocationTracker::getThreadAllocations() {
+  return threadAllocations;
+}
+
+void AllocationTracker::setAbortOnAllocation(bool isAborting) {
+  isAbortingOnAllocation = isAborting;
+}
+
+void AllocationTracker::recordAllocation() {
+  ++threadAllocations;
+  if (isAbortingOnAllocation) {
+    isAbortingOnAllocation = false;
+    std::abort();
+  }
+}
+
+void AllocationTracker::setAvailable() {
+  isInterposerLinked.store(true, std::memory_order_relaxed);
+}
+
+}  // namespace rocoma
@@ -0,0 +1,254 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     AsyncLogSink.cpp
+ * @date     Oct, 2026
+ */
+
+// rocoma
+#include "rocoma/common/AsyncLogSink.hpp"
+
+// Message logger
+#include <message_logger/message_logger.hpp>
+
+// STL
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+namespace rocoma {
+
+constexpr std::size_t AsyncLogSink::capacity_;
+constexpr std::size_t AsyncLogSink::maxNameLength_;
+constexpr std::size_t AsyncLogSink::maxTextLength_;
+
+namespace {
+
+enum class LogSeverity { INFO, WARN, ERROR };
+
+//! Severity and format of a message, the format takes the name and the text (or neither)
+struct LogMessageFormat {
+  LogSeverity severity_;
+  const char* format_;
+};
+
+// Indexed by LogMessageId
+const LogMessageFormat logMessageFormats[] = {
+    {LogSeverity::WARN, "[Rocoma][%s] Has already been created!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Could not be created!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while creating: %s"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while creating!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Not created on initialize!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Could not be initialized!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while initializing:\n%s"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while initializing!\n"},
+    {LogSeverity::WARN, "[Rocoma][%s] Not initialized on advance!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Could not advance!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while advancing: %s"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while advancing! "},
+    {LogSeverity::ERROR, "[Rocoma][%s] Bad state!"},
+    {LogSeverity::ERROR, "[Rocoma][%s] The command is invalid!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Has not been created!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Could not reset controller!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while resetting: %s"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while resetting!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Was not created!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Could not clean up!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while cleaning up: %s"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while cleaning up!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Could not be stopped!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while stopping: %s"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while stopping!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Could not prepare to stop controller!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while pre-stopping: %s"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while pre-stopping! "},
+    {LogSeverity::WARN, "[Rocoma][%s] Not created on swap!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Could not be swapped!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while swapping:\n%s"},
+    {LogSeverity::WARN, "[Rocoma][%s] Exception caught while swapping!\n"},
+    {LogSeverity::WARN, "[Rocoma][%s] Advance took %s"},
+    {LogSeverity::ERROR, "[Rocoma] Emergency Stop!"},
+    {LogSeverity::ERROR, "[Rocoma] Failproof Stop!"},
+    {LogSeverity::WARN, "[Rocoma][%s] Is being advanced in hot standby, handing over the command computed in shadow."},
+    {LogSeverity::INFO, "[Rocoma] Switched to failproof controller!"},
+};
+
+static_assert(sizeof(logMessageFormats) / sizeof(logMessageFormats[0]) == static_cast<std::size_t>(LogMessageId::NUM_MESSAGES),
+              "Every LogMessageId needs a format.");
+
+//! Copies at most maxLength characters and terminates the copy
+void copyTruncated(char* destination, const char* source, std::size_t length, std::size_t maxLength) {
+  length = std::min(length, maxLength);
+  std::memcpy(destination, source, length);
+  destination[length] = '\0';
+}
+
+}  // namespace
+
+AsyncLogSink& AsyncLogSink::getInstance() {
+  static AsyncLogSink sink;
+  return sink;
+}
+
+AsyncLogSink::AsyncLogSink()
+    : records_(capacity_),
+      numDroppedMessages_(0u),
+      numReportedDrops_(0u),
+      isRunning_(false),
+      numProducers_{0u},
+      numStarts_(0u),
+      pollPeriod_(0.01),
+      isStopping_(false) {}
+
+AsyncLogSink::~AsyncLogSink() {
+  {
+    std::lock_guard<std::mutex> lock(stopMutex_);
+    isStopping_ = true;
+  }
+  stopRequested_.notify_all();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void AsyncLogSink::start(double pollPeriod) {
+  std::lock_guard<std::mutex> lockLifecycle(lifecycleMutex_);
+  if (numStarts_++ > 0u) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(stopMutex_);
+    isStopping_ = false;
+  }
+  pollPeriod_ = pollPeriod;
+  thread_ = std::thread(&AsyncLogSink::run, this);
+  isRunning_.store(true, std::memory_order_release);
+}
+
+void AsyncLogSink::stop() {
+  std::lock_guard<std::mutex> lockLifecycle(lifecycleMutex_);
+  if (numStarts_ == 0u || --numStarts_ > 0u) {
+    return;
+  }
+  // New log calls format on their thread, the ones that saw the sink running push before the last drain (both sequentially consistent)
+  isRunning_.store(false);
+  while (numProducers_.load() != 0u) {
+    std::this_thread::yield();
+  }
+  {
+    std::lock_guard<std::mutex> lock(stopMutex_);
+    isStopping_ = true;
+  }
+  stopRequested_.notify_all();
+  thread_.join();
+  drain();
+}
+
+void AsyncLogSink::log(LogMessageId id, const std::string& name, const char* text) {
+  numProducers_.fetch_add(1u);
+  if (!isRunning_.load()) {
+    numProducers_.fetch_sub(1u, std::memory_order_release);
+    forward(id, name.c_str(), text == nullptr ? "" : text);
+    return;
+  }
+
+  Record record;
+  record.id_ = id;
+  copyTruncated(record.name_, name.c_str(), name.size(), maxNameLength_);
+  if (text == nullptr) {
+    record.text_[0] = '\0';
+  } else {
+    copyTruncated(record.text_, text, std::strlen(text), maxTextLength_);
+  }
+  if (!records_.tryPush(record)) {
+    numDroppedMessages_.fetch_add(1u, std::memory_order_relaxed);
+  }
+  numProducers_.fetch_sub(1u, std::memory_order_release);
+}
+
+void AsyncLogSink::flush() {
+  drain();
+}
+
+void AsyncLogSink::drain() {
+  std::lock_guard<std::mutex> lockConsumer(consumerMutex_);
+  Record record;
+  while (records_.tryPop(record)) {
+    forward(record.id_, record.name_, record.text_);
+  }
+
+  const std::uint64_t numDroppedMessages = numDroppedMessages_.load(std::memory_order_relaxed);
+  if (numDroppedMessages != numReportedDrops_) {
+    MELO_WARN("[Rocoma] Log sink was full, dropped %" PRIu64 " messages.", numDroppedMessages - numReportedDrops_);
+    numReportedDrops_ = numDroppedMessages;
+  }
+}
+
+void AsyncLogSink::run() {
+  const auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(pollPeriod_));
+  std::unique_lock<std::mutex> lock(stopMutex_);
+  while (!stopRequested_.wait_for(lock, period, [this]() { return isStopping_; })) {
+    lock.unlock();
+    drain();
+    lock.lock();
+  }
+}
+
+void AsyncLogSink::forward(LogMessageId id, const char* name, const char* text) {
+  const std::size_t index = static_cast<std::size_t>(id);
+  if (index >= static_cast<std::size_t>(LogMessageId::NUM_MESSAGES)) {
+    return;
+  }
+  const LogMessageFormat& format = logMessageFormats[index];
+
+  // The format takes the name and the text, unused arguments are ignored
+  char message[maxNameLength_ + maxTextLength_ + 128u];
+  std::snprintf(message, sizeof(message), format.format_, name, text);
+  switch (format.severity_) {
+    case LogSeverity::INFO:
+      MELO_INFO("%s", message);
+      break;
+    case LogSeverity::WARN:
+      MELO_WARN("%s", message);
+      break;
+    case LogSeverity::ERROR:
+      MELO_ERROR("%s", message);
+      break;
+  }
+}
+
+}  // namespace rocoma
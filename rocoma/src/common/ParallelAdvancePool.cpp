@@ -0,0 +1,192 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     ParallelAdvancePool.cpp
+ * @date     Oct, 2026
+ */
+
+// rocoma
+#include "rocoma/common/ParallelAdvancePool.hpp"
+
+// Message logger
+#include "message_logger/message_logger.hpp"
+
+// POSIX
+#include <pthread.h>
+#include <sched.h>
+
+// STL
+#include <cstring>
+
+namespace rocoma {
+
+ParallelAdvancePool::ParallelAdvancePool(const ParallelAdvancePoolOptions& options)
+    : options_(options),
+      mutex_(),
+      batchStarted_(),
+      batchFinished_(),
+      task_(nullptr),
+      numTasks_(0u),
+      nextTask_{0u},
+      batch_(0u),
+      callerPolicy_(SCHED_OTHER),
+      callerPriority_(0),
+      numBusyWorkers_(0u),
+      isStopping_(false),
+      threads_() {
+  threads_.reserve(options_.numThreads);
+  for (unsigned int k = 0u; k < options_.numThreads; ++k) {
+    threads_.emplace_back(&ParallelAdvancePool::work, this, k);
+  }
+}
+
+ParallelAdvancePool::~ParallelAdvancePool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isStopping_ = true;
+  }
+  batchStarted_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void ParallelAdvancePool::run(std::size_t numTasks, const Task& task) {
+  // Not worth waking up the workers
+  if (threads_.empty() || numTasks < 2u) {
+    for (std::size_t i = 0u; i < numTasks; ++i) {
+      task(i);
+    }
+    return;
+  }
+
+  // The workers follow the scheduling of the calling thread, e.g. the real-time tick thread
+  int callerPolicy = SCHED_OTHER;
+  sched_param callerParameters{};
+  if (options_.priority <= 0 && pthread_getschedparam(pthread_self(), &callerPolicy, &callerParameters) != 0) {
+    callerPolicy = SCHED_OTHER;
+    callerParameters.sched_priority = 0;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    callerPolicy_ = callerPolicy;
+    callerPriority_ = callerParameters.sched_priority;
+    task_ = &task;
+    numTasks_ = numTasks;
+    nextTask_ = 0u;
+    numBusyWorkers_ = getNumThreads();
+    ++batch_;
+  }
+  batchStarted_.notify_all();
+
+  // The calling thread participates, then waits for the workers to leave the batch
+  runTasks();
+  std::unique_lock<std::mutex> lock(mutex_);
+  batchFinished_.wait(lock, [this]() { return numBusyWorkers_ == 0u; });
+  task_ = nullptr;
+}
+
+void ParallelAdvancePool::work(unsigned int workerIndex) {
+  setupThread(workerIndex);
+
+  std::uint64_t batch = 0u;
+  int policy = SCHED_OTHER;
+  int priority = 0;
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    batchStarted_.wait(lock, [this, batch]() { return isStopping_ || batch_ != batch; });
+    if (isStopping_) {
+      return;
+    }
+    batch = batch_;
+
+    lock.unlock();
+    if (options_.priority <= 0) {
+      inheritScheduling(policy, priority);
+    }
+    runTasks();
+    lock.lock();
+
+    if (--numBusyWorkers_ == 0u) {
+      batchFinished_.notify_one();
+    }
+  }
+}
+
+void ParallelAdvancePool::runTasks() {
+  for (std::size_t i = nextTask_++; i < numTasks_; i = nextTask_++) {
+    (*task_)(i);
+  }
+}
+
+void ParallelAdvancePool::inheritScheduling(int& policy, int& priority) const {
+  // Written before the batch was started
+  if (callerPolicy_ == policy && callerPriority_ == priority) {
+    return;
+  }
+  policy = callerPolicy_;
+  priority = callerPriority_;
+  sched_param parameters{};
+  parameters.sched_priority = priority;
+  const int error = pthread_setschedparam(pthread_self(), policy, &parameters);
+  if (error != 0) {
+    MELO_WARN("[Rocoma] Could not inherit scheduling policy %d and priority %d of parallel advance worker: %s", policy, priority,
+              std::strerror(error));
+  }
+}
+
+void ParallelAdvancePool::setupThread(unsigned int workerIndex) const {
+  if (options_.priority > 0) {
+    sched_param parameters{};
+    parameters.sched_priority = options_.priority;
+    const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters);
+    if (error != 0) {
+      MELO_WARN("[Rocoma] Could not set SCHED_FIFO priority %d of parallel advance worker: %s", options_.priority, std::strerror(error));
+    }
+  }
+
+  if (workerIndex < options_.cpuAffinities.size() && options_.cpuAffinities[workerIndex] >= 0) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(options_.cpuAffinities[workerIndex], &cpuSet);
+    const int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+    if (error != 0) {
+      MELO_WARN("[Rocoma] Could not pin parallel advance worker to cpu %d: %s", options_.cpuAffinities[workerIndex], std::strerror(error));
+    }
+  }
+}
+
+}  // namespace rocoma
@@ -0,0 +1,121 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     StopExecutor.cpp
+ * @date     Oct, 2026
+ */
+
+// rocoma
+#include "rocoma/common/StopExecutor.hpp"
+
+// STL
+#include <chrono>
+#include <utility>
+
+namespace rocoma {
+
+constexpr std::size_t StopExecutor::capacity_;
+
+StopExecutor::StopExecutor(StopCallback callback)
+    : callback_(std::move(callback)),
+      queue_(capacity_),
+      requestAvailable_(),
+      isShuttingDown_{false},
+      numSubmitting_{0u},
+      submitted_{0u},
+      completed_{0u},
+      mutex_(),
+      requestCompleted_(),
+      thread_() {
+  thread_ = std::thread(&StopExecutor::execute, this);
+}
+
+StopExecutor::~StopExecutor() {
+  isShuttingDown_ = true;
+  requestAvailable_.post();
+  thread_.join();
+}
+
+bool StopExecutor::submit(roco::ControllerAdapterInterface* controller) {
+  // Counted before pushing, the pending count never drops below zero
+  ++numSubmitting_;
+  submitted_.fetch_add(1u);
+  const bool isQueued = !isShuttingDown_ && queue_.tryPush(controller);
+  if (!isQueued) {
+    submitted_.fetch_sub(1u);
+  }
+  --numSubmitting_;
+
+  if (!isQueued) {
+    // Slow path, the caller stops the controller itself. Wake waitUntilIdle, it might have seen the pending request.
+    std::lock_guard<std::mutex> lock(mutex_);
+    requestCompleted_.notify_all();
+    return false;
+  }
+  requestAvailable_.post();
+  return true;
+}
+
+bool StopExecutor::waitUntilIdle(double timeout) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  return requestCompleted_.wait_for(lock, std::chrono::duration<double>(timeout), [this]() { return getPendingCount() == 0u; });
+}
+
+void StopExecutor::execute() {
+  roco::ControllerAdapterInterface* controller = nullptr;
+  while (true) {
+    requestAvailable_.wait();
+    const bool isShuttingDown = isShuttingDown_;
+    if (isShuttingDown) {
+      // Submit calls that passed the shutdown check push before they leave
+      while (numSubmitting_ != 0u) {
+        std::this_thread::yield();
+      }
+    }
+
+    while (queue_.tryPop(controller)) {
+      callback_(controller);
+      completed_.fetch_add(1u);
+      std::lock_guard<std::mutex> lock(mutex_);
+      requestCompleted_.notify_all();
+    }
+
+    if (isShuttingDown) {
+      return;
+    }
+  }
+}
+
+}  // namespace rocoma
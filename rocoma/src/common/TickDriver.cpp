@@ -0,0 +1,229 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     TickDriver.cpp
+ * @date     Oct, 2026
+ */
+
+// rocoma
+#include "rocoma/common/TickDriver.hpp"
+
+// Message logger
+#include "message_logger/message_logger.hpp"
+
+// POSIX
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+// STL
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+namespace rocoma {
+
+namespace {
+
+constexpr std::int64_t nanosecondsPerSecond = 1000000000;
+
+std::int64_t toInt64(const timespec& time) {
+  return static_cast<std::int64_t>(time.tv_sec) * nanosecondsPerSecond + time.tv_nsec;
+}
+
+timespec toTimespec(std::int64_t nanoseconds) {
+  timespec time{};
+  time.tv_sec = static_cast<time_t>(nanoseconds / nanosecondsPerSecond);
+  time.tv_nsec = static_cast<long>(nanoseconds % nanosecondsPerSecond);  // NOLINT(google-runtime-int)
+  return time;
+}
+
+std::int64_t now() {
+  timespec time{};
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return toInt64(time);
+}
+
+void sleepUntil(std::int64_t deadline) {
+  const timespec time = toTimespec(deadline);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, nullptr) == EINTR) {
+  }
+}
+
+}  // namespace
+
+TickDriver::TickDriver(TickCallback callback, double timeStep, const TickDriverOptions& options)
+    : callback_(std::move(callback)),
+      period_(static_cast<std::int64_t>(toNanoseconds(timeStep))),
+      options_(options),
+      isRunning_{false},
+      stopRequested_{false},
+      stateMutex_(),
+      thread_(),
+      loopThreadId_(),
+      ticks_{0u},
+      missedDeadlines_{0u},
+      failedTicks_{0u},
+      wakeupLatency_() {}
+
+TickDriver::~TickDriver() {
+  stop();
+}
+
+bool TickDriver::start() {
+  std::lock_guard<std::mutex> lockState(stateMutex_);
+  if (isRunning_) {
+    MELO_WARN("[Rocoma] Tick driver is already running.");
+    return false;
+  }
+  isRunning_ = true;
+
+  // Thread of a loop that was stopped from within a tick
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+
+  thread_ = std::thread([this]() {
+    setupThread();
+    loop();
+  });
+  return true;
+}
+
+bool TickDriver::run() {
+  {
+    std::lock_guard<std::mutex> lockState(stateMutex_);
+    if (isRunning_) {
+      MELO_WARN("[Rocoma] Tick driver is already running.");
+      return false;
+    }
+    isRunning_ = true;
+  }
+
+  setupThread();
+  loop();
+  return true;
+}
+
+void TickDriver::stop() {
+  {
+    std::lock_guard<std::mutex> lockState(stateMutex_);
+    if (isRunning_) {
+      stopRequested_ = true;
+    }
+  }
+
+  // The loop ends after the current tick
+  if (loopThreadId_.load() == std::this_thread::get_id()) {
+    return;
+  }
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+  while (isRunning_) {
+    std::this_thread::yield();
+  }
+}
+
+TickDriverStatistics TickDriver::getStatistics() const {
+  TickDriverStatistics statistics;
+  statistics.ticks = ticks_.load(std::memory_order_relaxed);
+  statistics.missedDeadlines = missedDeadlines_.load(std::memory_order_relaxed);
+  statistics.failedTicks = failedTicks_.load(std::memory_order_relaxed);
+  statistics.wakeupLatency = wakeupLatency_.getStatistics();
+  return statistics;
+}
+
+void TickDriver::setupThread() const {
+  if (options_.priority > 0) {
+    sched_param parameters{};
+    parameters.sched_priority = options_.priority;
+    const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &parameters);
+    if (error != 0) {
+      MELO_WARN("[Rocoma] Could not set SCHED_FIFO priority %d of tick driver: %s", options_.priority, std::strerror(error));
+    }
+  }
+
+  if (options_.cpuAffinity >= 0) {
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    CPU_SET(options_.cpuAffinity, &cpuSet);
+    const int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+    if (error != 0) {
+      MELO_WARN("[Rocoma] Could not pin tick driver to cpu %d: %s", options_.cpuAffinity, std::strerror(error));
+    }
+  }
+}
+
+void TickDriver::loop() {
+  const std::int64_t busyWaitTail = static_cast<std::int64_t>(toNanoseconds(options_.busyWaitTail));
+  std::int64_t deadline = now();
+  loopThreadId_ = std::this_thread::get_id();
+
+  while (!stopRequested_.load(std::memory_order_relaxed)) {
+    deadline += period_;
+
+    // Sleep until the deadline, spin for the tail to avoid the wakeup latency of the scheduler
+    if (busyWaitTail > 0) {
+      sleepUntil(deadline - busyWaitTail);
+      while (now() < deadline) {
+      }
+    } else {
+      sleepUntil(deadline);
+    }
+
+    const std::int64_t wakeup = now();
+    wakeupLatency_.record(static_cast<std::uint64_t>(std::max<std::int64_t>(wakeup - deadline, 0)), 0u);
+    ticks_.fetch_add(1u, std::memory_order_relaxed);
+    if (!callback_()) {
+      failedTicks_.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    // Skip deadlines that passed during the tick
+    const std::int64_t missed = period_ > 0 ? (now() - deadline) / period_ : 0;
+    if (missed > 0) {
+      missedDeadlines_.fetch_add(static_cast<std::uint64_t>(missed), std::memory_order_relaxed);
+      deadline += missed * period_;
+    }
+  }
+
+  std::lock_guard<std::mutex> lockState(stateMutex_);
+  loopThreadId_ = std::thread::id();
+  stopRequested_ = false;
+  isRunning_ = false;
+}
+
+}  // namespace rocoma
@@ -0,0 +1,63 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests of the allocation tracking, built into a dedicated executable that always links the allocation interposer.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+
+#include "include/TestControllerManager.hpp"
+#include "rocoma/common/AllocationTracker.hpp"
+
+namespace rocoma {
+
+class TestControllerManagerAllocationTracking : public TestControllerManager {
+ public:
+  TestControllerManagerAllocationTracking()
+      : TestControllerManager([](rocoma::ControllerManagerOptions& options) {
+          options.allocationTrackingOptions.enable = true;
+          options.allocationTrackingOptions.warmupAdvances = 10u;
+        }) {}
+};
+
+TEST_F(TestControllerManagerAllocationTracking, advancesWithoutAllocationInSteadyState) {  // NOLINT
+  ASSERT_TRUE(AllocationTracker::isAvailable()) << "The allocation interposer is not linked.";
+
+  clearEstopAndSwitchController(simpleControllerA_);
+  for (unsigned int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(controllerManager_.updateController());
+  }
+  AllocationStatistics warmup;
+  ASSERT_TRUE(controllerManager_.getControllerAllocationStatistics(simpleControllerA_, warmup));
+  ASSERT_EQ(10u, warmup.numAdvances);
+
+  // Neither the advance nor the rest of the tick allocate
+  const std::uint64_t threadAllocations = AllocationTracker::getThreadAllocations();
+  for (unsigned int i = 0; i < 100; ++i) {
+    controllerManager_.updateController();
+  }
+  ASSERT_EQ(threadAllocations, AllocationTracker::getThreadAllocations());
+  AllocationStatistics steadyState;
+  ASSERT_TRUE(controllerManager_.getControllerAllocationStatistics(simpleControllerA_, steadyState));
+  ASSERT_EQ(110u, steadyState.numAdvances);
+  ASSERT_EQ(warmup.numAllocations, steadyState.numAllocations);
+  ASSERT_FALSE(controllerManager_.getControllerAllocationStatistics("NotAController", steadyState));
+}
+
+TEST(AllocationInterposer, rejectsInvalidAlignment) {  // NOLINT
+  ASSERT_TRUE(AllocationTracker::isAvailable()) << "The allocation interposer is not linked.";
+
+  void* memory = nullptr;
+  ASSERT_EQ(EINVAL, posix_memalign(&memory, 3u * sizeof(void*), 64u));
+  ASSERT_EQ(EINVAL, posix_memalign(&memory, sizeof(void*) / 2u, 64u));
+  ASSERT_EQ(nullptr, memory);
+  ASSERT_EQ(0, posix_memalign(&memory, 64u, 64u));
+  ASSERT_NE(nullptr, memory);
+  ASSERT_EQ(0u, reinterpret_cast<std::uintptr_t>(memory) % 64u);
+  free(memory);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+}  // namespace rocoma
@@ -6,6 +6,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "include/TestControllerManager.hpp"
 
 namespace rocoma {
@@ -112,4 +114,62 @@ TEST_F(TestControllerManager, updatesSuccessfullyFor10ms) {  // NOLINT
   cancelControllerManagerUpdate();
 }
 
+TEST_F(TestControllerManager, switchesControllerById) {  // NOLINT
+  const rocoma::ControllerId controllerIdA = controllerManager_.getControllerId(simpleControllerA_);
+  const rocoma::ControllerId controllerIdB = controllerManager_.getControllerId(simpleControllerB_);
+  ASSERT_NE(rocoma::invalidControllerId, controllerIdA);
+  ASSERT_NE(controllerIdA, controllerIdB);
+  ASSERT_EQ(rocoma::invalidControllerId, controllerManager_.getControllerId("NotAController"));
+
+  const std::vector<std::string> names = controllerManager_.getAvailableControllerNames();
+  ASSERT_TRUE(std::is_sorted(names.begin(), names.end()));
+
+  controllerManager_.clearEmergencyStop();
+  ASSERT_EQ(rocoma::ControllerManager::SwitchResponse::SWITCHING, controllerManager_.switchController(controllerIdB));
+  checkActiveController(simpleControllerB_);
+  ASSERT_EQ(rocoma::ControllerManager::SwitchResponse::RUNNING, controllerManager_.switchController(controllerIdB));
+  ASSERT_EQ(rocoma::ControllerManager::SwitchResponse::NOTFOUND, controllerManager_.switchController(rocoma::invalidControllerId));
+}
+
+TEST_F(TestControllerManager, replacesInactiveAndActiveControllers) {  // NOLINT
+  const auto makeController = [this](const std::string& controllerName) {
+    std::unique_ptr<SimpleCtrl> controller(new SimpleCtrl());
+    controller->setName(controllerName);
+    controller->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    controller->setParameterPath(controllerName + "/Parameters.xml");
+    return controller;
+  };
+
+  clearEstopAndSwitchController(simpleControllerA_);
+  ASSERT_TRUE(controllerManager_.replaceController(makeController(simpleControllerB_)));
+  runControllerManagerUpdateFor(0.025);
+  ASSERT_TRUE(controllerManager_.replaceController(makeController(simpleControllerA_)));
+  cancelControllerManagerUpdate();
+  checkActiveController(simpleControllerA_);
+  ASSERT_FALSE(controllerManager_.replaceController(makeController("NotAController")));
+
+  switchController(simpleControllerB_);
+  emergencyStop();
+  checkActiveController(simpleEmergencyController_);
+}
+
+TEST_F(TestControllerManager, publishesStatusOnTransitions) {  // NOLINT
+  const rocoma::ControllerManager::Status initialStatus = controllerManager_.getStatus();
+  ASSERT_EQ(rocoma::ControllerManager::State::FAILURE, initialStatus.state_);
+  ASSERT_EQ(simpleFailProofController_, *initialStatus.activeControllerName_);
+  ASSERT_FALSE(initialStatus.clearedEmergencyStop_);
+
+  clearEstopAndSwitchController(simpleControllerA_);
+  const rocoma::ControllerManager::Status status = controllerManager_.getStatus();
+  ASSERT_LT(initialStatus.version_, status.version_);
+  ASSERT_EQ(rocoma::ControllerManager::State::OK, status.state_);
+  ASSERT_EQ(controllerManager_.getControllerId(simpleControllerA_), status.activeControllerId_);
+  ASSERT_EQ(simpleControllerA_, *status.activeControllerName_);
+  ASSERT_TRUE(status.clearedEmergencyStop_);
+  ASSERT_LE(initialStatus.lastSwitchTime_, status.lastSwitchTime_);
+
+  ASSERT_TRUE(controllerManager_.updateController());
+  ASSERT_EQ(status.version_, controllerManager_.getStatus().version_);
+}
+
 }  // namespace rocoma
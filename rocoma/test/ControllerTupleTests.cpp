@@ -0,0 +1,213 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests for controller tuples and static controller adapters.
+ */
+
+#include <gtest/gtest.h>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "include/TestControllerManager.hpp"
+#include "rocoma/common/ParallelAdvancePool.hpp"
+#include "rocoma/controllers/ParallelControllerTuple.hpp"
+#include "rocoma/controllers/StaticControllerAdapter.hpp"
+#include "rocoma/controllers/StaticControllerTuple.hpp"
+
+namespace rocoma {
+
+//! Member of a parallel controller tuple counting its advances
+template <int Id_>
+class CountingMember : virtual public roco::Controller<RocoState, RocoCommand> {
+ public:
+  static std::atomic<int> numAdvances_;
+
+ protected:
+  bool create(double /*dt*/) override { return true; }
+  bool initialize(double /*dt*/) override { return true; }
+  bool advance(double /*dt*/) override {
+    ++numAdvances_;
+    return true;
+  }
+  bool reset(double /*dt*/) override { return true; }
+  bool preStop() override { return true; }
+  bool stop() override { return true; }
+  bool cleanup() override { return true; }
+};
+
+template <int Id_>
+std::atomic<int> CountingMember<Id_>::numAdvances_{0};
+
+//! Member that has to be advanced after the counting members 0 and 1
+class DependentMember : public CountingMember<2> {
+ public:
+  using AdvanceDependencies = std::tuple<CountingMember<0>, CountingMember<1>>;
+  static std::atomic_bool isOrdered_;
+
+ protected:
+  bool advance(double dt) override {
+    CountingMember<2>::advance(dt);
+    isOrdered_ = isOrdered_ && CountingMember<0>::numAdvances_ == numAdvances_ && CountingMember<1>::numAdvances_ == numAdvances_;
+    return true;
+  }
+};
+
+std::atomic_bool DependentMember::isOrdered_{true};
+
+TEST(ParallelControllerTuple, advancesMembersInDependencyOrder) {  // NOLINT
+  using Tuple = ParallelControllerTuple<RocoState, RocoCommand, CountingMember<0>, CountingMember<1>, DependentMember>;
+  ControllerAdapter<Tuple, RocoState, RocoCommand> controller;
+  controller.setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), std::make_shared<RocoCommand>(),
+                                std::make_shared<boost::shared_mutex>());
+  ASSERT_TRUE(controller.createController(0.001));
+  const std::vector<std::vector<std::size_t>> levels{{0u, 1u}, {2u}};
+  ASSERT_EQ(controller.getAdvanceLevels(), levels);
+
+  ASSERT_TRUE(controller.initializeController(0.001));
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_TRUE(controller.advanceController(0.001));
+  }
+  ASSERT_EQ(CountingMember<0>::numAdvances_, 100);
+  ASSERT_EQ(CountingMember<1>::numAdvances_, 100);
+  ASSERT_EQ(DependentMember::numAdvances_, 100);
+  ASSERT_TRUE(DependentMember::isOrdered_);
+  ASSERT_TRUE(controller.cleanupController());
+}
+
+//! Member throwing in its next advance iff isThrowing_ is set
+template <int Id_>
+class ThrowingMember : public CountingMember<20 + Id_> {
+ public:
+  static std::atomic_bool isThrowing_;
+
+ protected:
+  bool advance(double dt) override {
+    CountingMember<20 + Id_>::advance(dt);
+    if (isThrowing_.exchange(false)) {
+      throw std::runtime_error("ThrowingMember");
+    }
+    return true;
+  }
+};
+
+template <int Id_>
+std::atomic_bool ThrowingMember<Id_>::isThrowing_{false};
+
+TEST(ParallelControllerTuple, rethrowsOnlyExceptionsOfTheLastAdvance) {  // NOLINT
+  using Tuple = ParallelControllerTuple<RocoState, RocoCommand, ThrowingMember<0>, ThrowingMember<1>>;
+  StaticControllerAdapter<Tuple, RocoState, RocoCommand, NoCheckPolicy, ManualTimePolicy, PropagateExceptionPolicy> controller;
+  controller.setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), std::make_shared<RocoCommand>(),
+                                std::make_shared<boost::shared_mutex>());
+  ASSERT_TRUE(controller.createController(0.001));
+  ASSERT_EQ(1u, controller.getAdvanceLevels().size());
+  ASSERT_TRUE(controller.initializeController(0.001));
+
+  // Both members of the level throw, only one exception is rethrown
+  ThrowingMember<0>::isThrowing_ = true;
+  ThrowingMember<1>::isThrowing_ = true;
+  EXPECT_THROW(controller.advanceController(0.001), std::runtime_error);
+  EXPECT_FALSE(ThrowingMember<0>::isThrowing_);
+  EXPECT_FALSE(ThrowingMember<1>::isThrowing_);
+  EXPECT_NO_THROW(EXPECT_TRUE(controller.advanceController(0.001)));
+  EXPECT_TRUE(controller.cleanupController());
+}
+
+//! Member recording the order of the advances, fails iff IsSuccessful_ is false
+template <int Id_, bool IsSuccessful_>
+class RecordingMember : public CountingMember<10 + Id_> {
+ public:
+  static std::vector<int> advancedMembers_;
+
+ protected:
+  bool advance(double dt) override {
+    CountingMember<10 + Id_>::advance(dt);
+    RecordingMember<0, true>::advancedMembers_.push_back(Id_);  // shared by all members
+    return IsSuccessful_;
+  }
+};
+
+template <int Id_, bool IsSuccessful_>
+std::vector<int> RecordingMember<Id_, IsSuccessful_>::advancedMembers_;
+
+TEST(StaticControllerTuple, advancesMembersInOrderUntilFailure) {  // NOLINT
+  using Tuple =
+      StaticControllerTuple<RocoState, RocoCommand, RecordingMember<0, true>, RecordingMember<1, false>, RecordingMember<2, true>>;
+  ControllerAdapter<Tuple, RocoState, RocoCommand> controller;
+  controller.setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), std::make_shared<RocoCommand>(),
+                                std::make_shared<boost::shared_mutex>());
+  ASSERT_TRUE(controller.createController(0.001));
+  ASSERT_TRUE(controller.initializeController(0.001));
+  ASSERT_FALSE(controller.advanceController(0.001));
+  using FirstMember = RecordingMember<0, true>;
+  const std::vector<int> advancedMembers{0, 1};
+  ASSERT_EQ(FirstMember::advancedMembers_, advancedMembers);
+  ASSERT_TRUE(controller.cleanupController());
+}
+
+TEST(ParallelAdvancePool, runsEveryTaskOnce) {  // NOLINT
+  ParallelAdvancePoolOptions options;
+  options.numThreads = 3u;
+  ParallelAdvancePool pool(options);
+  std::vector<std::atomic<int>> counts(64u);
+  const ParallelAdvancePool::Task task = [&counts](std::size_t i) { ++counts[i]; };
+  for (int batch = 0; batch < 100; ++batch) {
+    pool.run(counts.size(), task);
+  }
+  for (const auto& count : counts) {
+    ASSERT_EQ(count, 100);
+  }
+}
+
+TEST(ParallelAdvancePool, inheritsSchedulingOfCallingThread) {  // NOLINT
+  ParallelAdvancePoolOptions options;
+  options.numThreads = 2u;
+  ParallelAdvancePool pool(options);
+  std::vector<int> policies(16u, -1);
+  const ParallelAdvancePool::Task task = [&policies](std::size_t i) {
+    sched_param parameters{};
+    pthread_getschedparam(pthread_self(), &policies[i], &parameters);
+  };
+
+  // SCHED_BATCH does not require privileges
+  std::thread caller([&pool, &policies, &task]() {
+    sched_param parameters{};
+    ASSERT_EQ(0, pthread_setschedparam(pthread_self(), SCHED_BATCH, &parameters));
+    pool.run(policies.size(), task);
+  });
+  caller.join();
+  for (const int policy : policies) {
+    ASSERT_EQ(SCHED_BATCH, policy);
+  }
+}
+
+TEST(StaticControllerAdapter, appliesCheckPolicy) {  // NOLINT
+  auto command = std::make_shared<RocoCommand>();
+  StaticControllerAdapter<SimpleController, RocoState, RocoCommand> checkingController;
+  StaticControllerAdapter<SimpleController, RocoState, RocoCommand, NoCheckPolicy, ManualTimePolicy, PropagateExceptionPolicy> controller;
+  checkingController.setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), command,
+                                        std::make_shared<boost::shared_mutex>());
+  controller.setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), command,
+                                std::make_shared<boost::shared_mutex>());
+  ASSERT_FALSE(controller.advanceController(0.001));
+  ASSERT_TRUE(checkingController.createController(0.001));
+  ASSERT_TRUE(checkingController.initializeController(0.001));
+  ASSERT_TRUE(controller.createController(0.001));
+  ASSERT_TRUE(controller.initializeController(0.001));
+
+  command->setValue(2.0 * RocoCommand::maxValue_);
+  ASSERT_TRUE(controller.advanceController(0.001));
+  ASSERT_DOUBLE_EQ(2.0 * RocoCommand::maxValue_, command->getValue());
+  ASSERT_TRUE(checkingController.advanceController(0.001));
+  ASSERT_DOUBLE_EQ(RocoCommand::maxValue_, command->getValue());
+  ASSERT_TRUE(controller.cleanupController());
+  ASSERT_TRUE(checkingController.cleanupController());
+}
+
+}  // namespace rocoma
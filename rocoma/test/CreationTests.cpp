@@ -0,0 +1,94 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests for the concurrent and lazy creation of controllers.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "include/TestControllerManager.hpp"
+
+namespace rocoma {
+
+namespace {
+
+void createConcurrently(rocoma::ControllerManagerOptions& options) {
+  options.maxCreationThreads = 0u;
+}
+
+void createLazily(rocoma::ControllerManagerOptions& options) {
+  options.lazyControllerCreation = true;
+}
+
+void createAheadInBackground(rocoma::ControllerManagerOptions& options) {
+  options.lazyControllerCreation = true;
+  options.createAheadInBackground = true;
+}
+
+}  // namespace
+
+using TestControllerManagerConcurrentCreation = TestControllerManagerWithOptions<&createConcurrently>;
+using TestControllerManagerLazyCreation = TestControllerManagerWithOptions<&createLazily>;
+using TestControllerManagerCreateAhead = TestControllerManagerWithOptions<&createAheadInBackground>;
+
+TEST_F(TestControllerManagerConcurrentCreation, addsControllerPairsConcurrently) {  // NOLINT
+  using ControllerPairPtr =
+      std::pair<std::unique_ptr<roco::ControllerAdapterInterface>, std::unique_ptr<roco::EmergencyControllerAdapterInterface>>;
+  std::vector<ControllerPairPtr> controllerPairs;
+  for (const char* controllerName : {"SimpleControllerC", "SimpleControllerD", "SimpleControllerA"}) {
+    std::unique_ptr<SimpleCtrl> controller(new SimpleCtrl());
+    controller->setName(controllerName);
+    controller->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    std::unique_ptr<EmergencyCtrl> emgcyController(new EmergencyCtrl());
+    emgcyController->setName("SimpleEmergencyControllerC");
+    emgcyController->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    controllerPairs.emplace_back(std::move(controller), std::move(emgcyController));
+  }
+
+  std::vector<ControllerCreationResult> results;
+  ASSERT_FALSE(controllerManager_.addControllerPairs(std::move(controllerPairs), &results));  // SimpleControllerA already exists
+  ASSERT_EQ(3u, results.size());  // C, D and one instance of the emergency controller
+  for (const auto& result : results) {
+    ASSERT_TRUE(result.success_);
+    ASSERT_GE(result.createTime_, 0.0);
+  }
+
+  clearEstopAndSwitchController("SimpleControllerD");
+  ASSERT_TRUE(controllerManager_.updateController());
+  emergencyStop();
+  checkActiveController("SimpleEmergencyControllerC");
+}
+
+TEST_F(TestControllerManagerLazyCreation, createsControllerOnFirstSwitch) {  // NOLINT
+  const unsigned int numRegisteredControllers = controllerManager_.getLazyCreationReport().numRegisteredControllers_;
+  ASSERT_GT(numRegisteredControllers, 1u);
+  ASSERT_EQ(controllerManager_.getLazyCreationReport().numCreatedControllers_, 0u);
+
+  clearEstopAndSwitchController(simpleControllerA_);
+  checkActiveController(simpleControllerA_);
+  switchController(simpleControllerB_);
+  emergencyStop();
+  clearEstopAndSwitchController(simpleControllerA_);  // Created already
+
+  const LazyCreationReport report = controllerManager_.getLazyCreationReport();
+  ASSERT_EQ(report.numRegisteredControllers_, numRegisteredControllers);
+  ASSERT_EQ(report.numCreatedControllers_, 2u);
+  ASSERT_GE(report.createTime_, 0.0);
+}
+
+TEST_F(TestControllerManagerCreateAhead, createsControllersInBackground) {  // NOLINT
+  ASSERT_TRUE(waitUntil([this]() {
+    const LazyCreationReport report = controllerManager_.getLazyCreationReport();
+    return report.numCreatedControllers_ == report.numRegisteredControllers_;
+  }));
+  const LazyCreationReport report = controllerManager_.getLazyCreationReport();
+  ASSERT_GT(report.numRegisteredControllers_, 0u);
+  ASSERT_EQ(report.numCreatedControllers_, report.numRegisteredControllers_);
+  clearEstopAndSwitchController(sleepyControllerA_);
+  checkActiveController(sleepyControllerA_);
+}
+
+}  // namespace rocoma
@@ -0,0 +1,179 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests for emergency controllers in hot standby.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "include/TestControllerManager.hpp"
+
+namespace rocoma {
+
+namespace {
+
+void enableHotStandby(rocoma::ControllerManagerOptions& options) {
+  options.hotStandbyEmergencyControllers = true;
+}
+
+//! Emergency controller counting its fast initializations and advances, its advance can be held to emergency stop mid-tick
+class LatchedEmergencyController : public EmergencyController {
+ public:
+  std::atomic<int> numFastInitializations_{0};
+  std::atomic<int> numAdvances_{0};
+  std::atomic_bool isHoldingAdvance_{false};
+  std::atomic_bool isAdvanceHeld_{false};
+
+ protected:
+  bool initializeFast(double /*dt*/) override {
+    ++numFastInitializations_;
+    getCommand().setValue(0.5);
+    return true;
+  }
+  bool advance(double /*dt*/) override {
+    while (isHoldingAdvance_) {
+      isAdvanceHeld_ = true;
+      std::this_thread::yield();
+    }
+    isAdvanceHeld_ = false;
+    getCommand().setValue(1.5);
+    ++numAdvances_;
+    return true;
+  }
+};
+
+}  // namespace
+
+class TestControllerManagerHotStandby : public TestControllerManagerWithOptions<&enableHotStandby> {
+ protected:
+  using LatchedEmgcyCtrl = EmergencyControllerAdapter<LatchedEmergencyController, RocoState, RocoCommand>;
+
+  //! Adds the pair of latchedController_ and latchedEmgcyController_, @return the emergency controller
+  LatchedEmgcyCtrl* addLatchedControllerPair() {
+    std::unique_ptr<SimpleCtrl> controller(new SimpleCtrl());
+    controller->setName(latchedController_);
+    controller->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    std::unique_ptr<LatchedEmgcyCtrl> emgcyController(new LatchedEmgcyCtrl());
+    emgcyController->setName(latchedEmgcyController_);
+    emgcyController->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    LatchedEmgcyCtrl* emgcyControllerPtr = emgcyController.get();
+    EXPECT_TRUE(controllerManager_.addControllerPair(std::move(controller), std::move(emgcyController)));
+    return emgcyControllerPtr;
+  }
+
+  const std::string latchedController_ = std::string{"LatchedController"};
+  const std::string latchedEmgcyController_ = std::string{"LatchedEmergencyController"};
+};
+
+TEST_F(TestControllerManagerHotStandby, handsOverOnEstop) {  // NOLINT
+  LatchedEmgcyCtrl* emgcyController = addLatchedControllerPair();
+  runControllerManagerUpdateFor(0.1);
+  clearEstopAndSwitchController(latchedController_);
+  EXPECT_TRUE(waitUntil([emgcyController]() { return emgcyController->isInHotStandby() && emgcyController->numAdvances_ > 0; }));
+  emergencyStop();
+  checkActiveController(latchedEmgcyController_);
+  EXPECT_EQ(1, emgcyController->numFastInitializations_);  // Taken over, not fast initialized again
+  EXPECT_EQ(1u, controllerManager_.getEmergencyStopLatencyStatistics().count);
+
+  // Same emergency controller, enters hot standby again after it was stopped
+  clearEstopAndSwitchController(latchedController_);
+  EXPECT_TRUE(waitUntil([emgcyController]() { return emgcyController->isInHotStandby(); }));
+  const int numAdvances = emgcyController->numAdvances_;
+  EXPECT_TRUE(waitUntil([emgcyController, numAdvances]() { return emgcyController->numAdvances_ > numAdvances; }));
+  emergencyStop();
+  checkActiveController(latchedEmgcyController_);
+  EXPECT_EQ(2, emgcyController->numFastInitializations_);
+  EXPECT_EQ(2u, controllerManager_.getEmergencyStopLatencyStatistics().count);
+  cancelControllerManagerUpdate();
+}
+
+TEST_F(TestControllerManagerHotStandby, handsOverOnEstopDuringHotStandbyTick) {  // NOLINT
+  LatchedEmgcyCtrl* emgcyController = addLatchedControllerPair();
+  clearEstopAndSwitchController(latchedController_);
+  ASSERT_TRUE(waitUntil([emgcyController]() { return emgcyController->numAdvances_ > 0; }));
+
+  // Hold the hot standby thread in the advance of the emergency controller
+  emgcyController->isHoldingAdvance_ = true;
+  ASSERT_TRUE(waitUntil([emgcyController]() { return emgcyController->isAdvanceHeld_.load(); }));
+  command_->setValue(0.0);
+
+  // Never waits for the hot standby thread, nor moves on to the failproof controller
+  emergencyStop();
+  checkActiveController(latchedEmgcyController_);
+  EXPECT_EQ(ControllerManager::State::EMERGENCY, controllerManager_.getControllerManagerState());
+  EXPECT_DOUBLE_EQ(1.5, command_->getValue());  // Command of the last completed advance in shadow
+  EXPECT_EQ(1u, controllerManager_.getEmergencyStopLatencyStatistics().count);
+
+  // The tick skips the emergency controller while the hot standby thread advances it
+  const int numAdvances = emgcyController->numAdvances_;
+  EXPECT_TRUE(controllerManager_.updateController());
+  EXPECT_EQ(numAdvances, emgcyController->numAdvances_);
+
+  // The hot standby thread completes the hand over after its tick, then the tick advances the emergency controller
+  emgcyController->isHoldingAdvance_ = false;
+  EXPECT_TRUE(waitUntil([this, emgcyController, numAdvances]() {
+    EXPECT_TRUE(controllerManager_.updateController());
+    return emgcyController->numAdvances_ > numAdvances + 1;
+  }));
+  EXPECT_FALSE(emgcyController->isInHotStandby());
+  EXPECT_EQ(1, emgcyController->numFastInitializations_);
+  EXPECT_EQ(ControllerManager::State::EMERGENCY, controllerManager_.getControllerManagerState());
+}
+
+//! Emergency controller commanding a constant value
+class CommandingEmergencyController : public EmergencyController {
+ public:
+  int numStops_{0};
+
+ protected:
+  bool advance(double /*dt*/) override {
+    getCommand().setValue(1.0);
+    return true;
+  }
+  bool stop() override {
+    ++numStops_;
+    getCommand().setValue(2.0);
+    return true;
+  }
+};
+
+TEST(EmergencyControllerAdapter, advancesInHotStandby) {  // NOLINT
+  auto command = std::make_shared<RocoCommand>();
+  EmergencyControllerAdapter<CommandingEmergencyController, RocoState, RocoCommand> controller;
+  controller.setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), command,
+                                std::make_shared<boost::shared_mutex>());
+  ASSERT_TRUE(controller.createController(0.001));
+
+  ASSERT_TRUE(controller.enterHotStandby(0.001));
+  ASSERT_TRUE(controller.isInHotStandby());
+  ASSERT_FALSE(controller.isRunning());
+  ASSERT_TRUE(controller.advanceInHotStandby(0.001));
+  ASSERT_DOUBLE_EQ(0.0, command->getValue());
+
+  ASSERT_TRUE(controller.takeOverFromHotStandby());
+  ASSERT_FALSE(controller.isInHotStandby());
+  ASSERT_TRUE(controller.isRunning());
+  ASSERT_DOUBLE_EQ(1.0, command->getValue());
+  ASSERT_TRUE(controller.cleanupController());
+}
+
+TEST(EmergencyControllerAdapter, stopsOnLeavingHotStandby) {  // NOLINT
+  auto command = std::make_shared<RocoCommand>();
+  EmergencyControllerAdapter<CommandingEmergencyController, RocoState, RocoCommand> controller;
+  controller.setStateAndCommand(std::make_shared<RocoState>(), std::make_shared<boost::shared_mutex>(), command,
+                                std::make_shared<boost::shared_mutex>());
+  ASSERT_TRUE(controller.createController(0.001));
+
+  ASSERT_TRUE(controller.enterHotStandby(0.001));
+  ASSERT_TRUE(controller.advanceInHotStandby(0.001));
+  controller.leaveHotStandby();
+  ASSERT_FALSE(controller.isInHotStandby());
+  ASSERT_EQ(1, controller.numStops_);
+  ASSERT_DOUBLE_EQ(0.0, command->getValue());  // Stopped against the scratch command
+  ASSERT_TRUE(controller.cleanupController());
+}
+
+}  // namespace rocoma
@@ -0,0 +1,265 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests for the lock-free dispatch and the lock-free primitives of the controller manager.
+ */
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "include/TestControllerManager.hpp"
+#include "rocoma/common/BoundedQueue.hpp"
+#include "rocoma/common/RcuCell.hpp"
+#include "rocoma/common/SeqLock.hpp"
+
+namespace rocoma {
+
+namespace {
+
+void enableLockFreeDispatch(rocoma::ControllerManagerOptions& options) {
+  options.lockFreeDispatch = true;
+}
+
+//! Controller failing to advance after it was stopped
+class StopCheckingController : public SimpleController {
+ protected:
+  bool initialize(double /*dt*/) override {
+    isStopped_ = false;
+    return true;
+  }
+  bool advance(double /*dt*/) override { return !isStopped_; }
+  bool stop() override {
+    isStopped_ = true;
+    return true;
+  }
+
+ private:
+  std::atomic_bool isStopped_{false};
+};
+
+}  // namespace
+
+using TestControllerManagerLockFree = TestControllerManagerWithOptions<&enableLockFreeDispatch>;
+
+TEST_F(TestControllerManagerLockFree, updatesSuccessfully) {  // NOLINT
+  ASSERT_TRUE(controllerManager_.updateController());
+}
+
+TEST_F(TestControllerManagerLockFree, switchesFromControllerBToEmergencyOnEstop) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerB_);
+  ASSERT_TRUE(controllerManager_.updateController());
+  emergencyStop();
+  checkActiveController(simpleEmergencyController_);
+  ASSERT_TRUE(controllerManager_.updateController());
+}
+
+TEST_F(TestControllerManagerLockFree, allowsSwitchingWhileUpdating) {  // NOLINT
+  runControllerManagerUpdateFor(0.025);
+  clearEstopAndSwitchController(simpleControllerA_);
+  switchController(sleepyControllerA_);
+  emergencyStop();
+  clearEstopAndSwitchController(simpleControllerB_);
+  cancelControllerManagerUpdate();
+}
+
+TEST_F(TestControllerManagerLockFree, neverAdvancesStoppedControllerWhileSwitching) {  // NOLINT
+  using StopCheckingCtrl = ControllerAdapter<StopCheckingController, RocoState, RocoCommand>;
+  for (const char* controllerName : {"StopCheckingControllerA", "StopCheckingControllerB"}) {
+    std::unique_ptr<StopCheckingCtrl> controller(new StopCheckingCtrl());
+    controller->setName(controllerName);
+    controller->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    ASSERT_TRUE(controllerManager_.addControllerPair(std::move(controller), nullptr));
+  }
+  clearEstopAndSwitchController("StopCheckingControllerA");
+
+  // Tick as fast as possible, every switch races the dispatch of the stopped controller
+  std::atomic_bool isUpdating{true};
+  std::atomic<unsigned int> numFailedUpdates{0u};
+  std::thread updater([this, &isUpdating, &numFailedUpdates]() {
+    while (isUpdating) {
+      if (!controllerManager_.updateController()) {
+        ++numFailedUpdates;
+      }
+    }
+  });
+  // Every switch happens while the controller is ticking
+  bool hasTicked = true;
+  for (unsigned int i = 0; i < 200 && hasTicked; ++i) {
+    const std::uint64_t tickCount = controllerManager_.getStatus().tickCount_;
+    hasTicked = waitUntil([this, tickCount]() { return controllerManager_.getStatus().tickCount_ > tickCount; });
+    switchController(i % 2 == 0 ? "StopCheckingControllerB" : "StopCheckingControllerA");
+  }
+  isUpdating = false;
+  updater.join();
+
+  EXPECT_TRUE(hasTicked);
+  EXPECT_EQ(0u, numFailedUpdates);
+  checkActiveController("StopCheckingControllerA");
+}
+
+TEST(RcuCell, retiresRecordsAfterGracePeriod) {  // NOLINT
+  struct Record {
+    std::uint64_t value_;
+    std::uint64_t doubledValue_;
+  };
+  RcuCell<Record> cell(Record{0u, 0u});
+  const std::uint64_t numRecords = 20000u;
+
+  // All records with a value smaller or equal are retired
+  std::atomic<std::uint64_t> retiredValue{0u};
+  std::atomic_bool isConsistent{true};
+  std::vector<std::thread> readers;
+  for (unsigned int i = 0; i < 3; ++i) {
+    readers.emplace_back([&cell, &retiredValue, &isConsistent, numRecords]() {
+      std::uint64_t lastValue = 0u;
+      while (lastValue != numRecords) {
+        RcuCell<Record>::ReadGuard record = cell.read();
+        const bool isRetired = record->value_ != 0u && retiredValue.load() >= record->value_;
+        if (isRetired || record->doubledValue_ != 2u * record->value_ || record->value_ < lastValue) {
+          isConsistent = false;
+        }
+        lastValue = record->value_;
+      }
+    });
+  }
+  for (std::uint64_t value = 1u; value <= numRecords; ++value) {
+    cell.publish(Record{value, 2u * value});
+    retiredValue = value - 1u;
+  }
+  for (auto& reader : readers) {
+    reader.join();
+  }
+  EXPECT_TRUE(isConsistent);
+}
+
+TEST(RcuCell, waitsForReadersOfExchangedRecord) {  // NOLINT
+  RcuCell<int> cell(0);
+  RcuCell<int>::ReadGuard record = cell.read();
+  const std::size_t retiredSlot = cell.exchange(1);
+  ASSERT_EQ(0, *record);
+  ASSERT_EQ(1, *cell.read());
+
+  std::atomic_bool hasWaited{false};
+  std::thread writer([&cell, &hasWaited, retiredSlot]() {
+    cell.waitForReaders(retiredSlot);
+    hasWaited = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_FALSE(hasWaited);
+  record.release();
+  writer.join();
+  EXPECT_TRUE(hasWaited);
+  cell.waitForReaders(RcuCell<int>::noSlot_);
+}
+
+TEST(BoundedQueue, deliversEveryValueOnce) {  // NOLINT
+  BoundedQueue<std::uint32_t> queue(64u);
+  const std::uint32_t numProducers = 4u;
+  const std::uint32_t numValuesPerProducer = 20000u;
+  std::vector<std::atomic<unsigned int>> deliveries(numProducers * numValuesPerProducer);
+  std::atomic<std::uint32_t> numPopped{0u};
+
+  std::vector<std::thread> threads;
+  for (std::uint32_t producer = 0u; producer < numProducers; ++producer) {
+    threads.emplace_back([&queue, producer, numValuesPerProducer]() {
+      for (std::uint32_t i = 0u; i < numValuesPerProducer; ++i) {
+        while (!queue.tryPush(producer * numValuesPerProducer + i)) {
+          std::this_thread::yield();
+        }
+      }
+    });
+  }
+  for (unsigned int consumer = 0u; consumer < 2u; ++consumer) {
+    threads.emplace_back([&queue, &deliveries, &numPopped]() {
+      std::uint32_t value = 0u;
+      while (numPopped < deliveries.size()) {
+        if (queue.tryPop(value)) {
+          ++deliveries[value];
+          ++numPopped;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::uint32_t value = 0u;
+  EXPECT_FALSE(queue.tryPop(value));
+  for (const auto& numDeliveries : deliveries) {
+    ASSERT_EQ(1u, numDeliveries);
+  }
+}
+
+TEST(SeqLock, readsConsistentRecords) {  // NOLINT
+  struct Record {
+    std::uint64_t first_;
+    std::uint64_t second_;
+    std::uint64_t third_;
+  };
+  SeqLock<Record> seqLock(Record{0u, 0u, 0u});
+
+  std::atomic_bool isWriting{true};
+  std::thread writer([&seqLock, &isWriting]() {
+    for (std::uint64_t i = 1u; i <= 100000u; ++i) {
+      seqLock.store(Record{i, 2u * i, 3u * i});
+    }
+    isWriting = false;
+  });
+  bool isConsistent = true;
+  while (isWriting) {
+    const Record record = seqLock.load();
+    isConsistent = isConsistent && record.second_ == 2u * record.first_ && record.third_ == 3u * record.first_;
+  }
+  writer.join();
+
+  EXPECT_TRUE(isConsistent);
+  EXPECT_EQ(100000u, seqLock.load().first_);
+  EXPECT_EQ(100000u, seqLock.getNumStores());
+}
+
+TEST(TripleBuffer, handsOffLatestValue) {  // NOLINT
+  TripleBuffer<std::uint64_t> buffer(0u);
+  const std::uint64_t numValues = 100000u;
+  std::thread writer([&buffer, numValues]() {
+    for (std::uint64_t i = 1u; i <= numValues; ++i) {
+      buffer.write(i);
+    }
+  });
+
+  std::uint64_t value = 0u;
+  std::uint64_t lastValue = 0u;
+  while (lastValue != numValues) {
+    buffer.read(value);
+    ASSERT_GE(value, lastValue);
+    lastValue = value;
+  }
+  writer.join();
+  ASSERT_FALSE(buffer.read(value));
+}
+
+TEST(CommandChannel, publishesLimitedCommand) {  // NOLINT
+  auto state = std::make_shared<RocoState>();
+  auto command = std::make_shared<RocoCommand>();
+  auto channel = std::make_shared<TripleBuffer<RocoCommand>>();
+  ControllerAdapter<SimpleController, RocoState, RocoCommand> controller;
+  controller.setName("SimpleController");
+  controller.setStateAndCommand(state, std::make_shared<boost::shared_mutex>(), command, std::make_shared<boost::shared_mutex>());
+  controller.setCommandChannel(channel);
+  ASSERT_TRUE(controller.createController(0.001));
+  ASSERT_TRUE(controller.initializeController(0.001));
+
+  command->setValue(2.0 * RocoCommand::maxValue_);
+  ASSERT_TRUE(controller.advanceController(0.001));
+  RocoCommand latestCommand;
+  ASSERT_TRUE(channel->read(latestCommand));
+  ASSERT_DOUBLE_EQ(RocoCommand::maxValue_, latestCommand.getValue());
+  ASSERT_FALSE(channel->read(latestCommand));
+  ASSERT_TRUE(controller.cleanupController());
+}
+
+}  // namespace rocoma
@@ -0,0 +1,163 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests for the asynchronous logging and notifications of the controller manager.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "include/TestControllerManager.hpp"
+#include "rocoma/common/AsyncLogSink.hpp"
+
+namespace rocoma {
+
+TEST(AsyncLogSink, countsDroppedMessagesWhenFull) {  // NOLINT
+  AsyncLogSink& sink = AsyncLogSink::getInstance();
+  const std::uint64_t numDroppedBefore = sink.getNumDroppedMessages();
+
+  // Poll period longer than the test, only flush formats the messages
+  sink.start(60.0);
+  ASSERT_TRUE(sink.isRunning());
+  for (std::size_t i = 0u; i < AsyncLogSink::capacity_ + 5u; ++i) {
+    sink.log(LogMessageId::COULD_NOT_ADVANCE, "AsyncLogSinkTest");
+  }
+  EXPECT_EQ(numDroppedBefore + 5u, sink.getNumDroppedMessages());
+
+  sink.flush();
+  for (std::size_t i = 0u; i < AsyncLogSink::capacity_; ++i) {
+    sink.log(LogMessageId::EXCEPTION_WHILE_ADVANCING, "AsyncLogSinkTest", "what");
+  }
+  EXPECT_EQ(numDroppedBefore + 5u, sink.getNumDroppedMessages());
+
+  sink.stop();
+  EXPECT_FALSE(sink.isRunning());
+}
+
+TEST(AsyncLogSink, runsWhileAnyManagerUsesIt) {  // NOLINT
+  AsyncLogSink& sink = AsyncLogSink::getInstance();
+  ASSERT_FALSE(sink.isRunning());
+  ControllerManagerOptions options;
+  options.asyncLogging = true;
+  std::unique_ptr<ControllerManager> first(new ControllerManager(options));
+  std::unique_ptr<ControllerManager> second(new ControllerManager(options));
+  EXPECT_TRUE(sink.isRunning());
+
+  // Process-wide and reference counted, the second manager keeps it running
+  first.reset();
+  EXPECT_TRUE(sink.isRunning());
+  second.reset();
+  EXPECT_FALSE(sink.isRunning());
+
+  // An unmatched stop is ignored
+  sink.stop();
+  sink.start();
+  EXPECT_TRUE(sink.isRunning());
+  sink.stop();
+  EXPECT_FALSE(sink.isRunning());
+}
+
+namespace {
+
+//! Records the notifications and the thread they were delivered on
+class RecordingListener : public ControllerManager::Listener {
+ public:
+  void onEmergencyStop(ControllerManager::EmergencyStopType /*type*/) override { record("estop"); }
+  void onControllerChanged(const std::string& newControllerName) override { record(newControllerName); }
+
+  std::vector<std::string> getNotifications() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return notifications_;
+  }
+  bool wasCalledOn(std::thread::id threadId) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return std::find(threadIds_.begin(), threadIds_.end(), threadId) != threadIds_.end();
+  }
+  //! Blocks the delivering thread in the next notification until releaseDelivery is called
+  void holdDelivery() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    isHoldingDelivery_ = true;
+  }
+  void releaseDelivery() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      isHoldingDelivery_ = false;
+    }
+    deliveryReleased_.notify_all();
+  }
+
+ private:
+  void record(const std::string& notification) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    notifications_.push_back(notification);
+    threadIds_.push_back(std::this_thread::get_id());
+    deliveryReleased_.wait(lock, [this]() { return !isHoldingDelivery_; });
+  }
+
+  mutable std::mutex mutex_;
+  std::condition_variable deliveryReleased_;
+  bool isHoldingDelivery_{false};
+  std::vector<std::string> notifications_;
+  std::vector<std::thread::id> threadIds_;
+};
+
+void enableAsyncNotifications(rocoma::ControllerManagerOptions& options) {
+  options.asyncNotifications = true;
+}
+
+}  // namespace
+
+using TestControllerManagerAsyncNotifications = TestControllerManagerWithOptions<&enableAsyncNotifications>;
+
+TEST_F(TestControllerManagerAsyncNotifications, notifiesListenersOnNotifierThread) {  // NOLINT
+  RecordingListener listener;
+  controllerManager_.addListener(&listener);
+  clearEstopAndSwitchController(simpleControllerA_);
+  emergencyStop();
+
+  // Wait for the notifier thread
+  EXPECT_TRUE(waitUntil([&listener]() { return listener.getNotifications().size() >= 3u; }));
+  const std::vector<std::string> expected{simpleControllerA_, "estop", simpleFailProofController_};
+  EXPECT_EQ(expected, listener.getNotifications());
+  EXPECT_FALSE(listener.wasCalledOn(std::this_thread::get_id()));
+
+  // Notifications are delivered in order, the remaining listener tells when the removed one would have been notified
+  RecordingListener remainingListener;
+  controllerManager_.removeListener(&listener);
+  controllerManager_.addListener(&remainingListener);
+  clearEstopAndSwitchController(simpleControllerB_);
+  EXPECT_TRUE(waitUntil([&remainingListener]() { return !remainingListener.getNotifications().empty(); }));
+  EXPECT_EQ(3u, listener.getNotifications().size());
+  controllerManager_.removeListener(&remainingListener);
+}
+
+TEST_F(TestControllerManagerAsyncNotifications, dropsNotificationsWhenFullButNeverEmergencyStops) {  // NOLINT
+  // The notifier thread blocks in the first notification until the queue overflowed
+  RecordingListener listener;
+  listener.holdDelivery();
+  controllerManager_.addListener(&listener);
+  clearEstopAndSwitchController(simpleControllerA_);
+  ASSERT_TRUE(waitUntil([&listener]() { return !listener.getNotifications().empty(); }));
+  for (unsigned int i = 0; i < 100; ++i) {
+    emergencyStop();
+    clearEstopAndSwitchController(i % 2 == 0 ? simpleControllerB_ : simpleControllerA_);
+  }
+  // The state change of the last emergency stop is dropped
+  const std::uint64_t numDroppedNotifications = controllerManager_.getNumDroppedNotifications();
+  emergencyStop();
+  EXPECT_GT(numDroppedNotifications, 0u);
+  EXPECT_GT(controllerManager_.getNumDroppedNotifications(), numDroppedNotifications);
+
+  // The last emergency stop did not fit into the queue, it is delivered after the queued notifications
+  listener.releaseDelivery();
+  EXPECT_TRUE(waitUntil([&listener]() { return listener.getNotifications().back() == "estop"; }));
+  controllerManager_.removeListener(&listener);
+}
+
+}  // namespace rocoma
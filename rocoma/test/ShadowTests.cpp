@@ -0,0 +1,75 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests for shadow controllers.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "include/TestControllerManager.hpp"
+
+namespace rocoma {
+
+TEST_F(TestControllerManager, advancesShadowController) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerA_);
+  ASSERT_FALSE(controllerManager_.attachShadowController(simpleControllerA_));  // Active
+  ASSERT_TRUE(controllerManager_.attachShadowController(simpleControllerB_));
+
+  runControllerManagerUpdateFor(0.05);
+  ShadowReport report;
+  EXPECT_TRUE(waitUntil([this, &report]() { return controllerManager_.getShadowReport(report) && report.numTicks_ > 0u; }));
+  ASSERT_EQ(report.controllerName_, simpleControllerB_);
+  ASSERT_GT(report.numTicks_, 0u);
+  ASSERT_EQ(report.numFailedTicks_, 0u);
+  ASSERT_EQ(report.advance_.count, report.numTicks_);
+  ASSERT_TRUE(report.hasCommandDivergence_);
+  ASSERT_DOUBLE_EQ(report.maxCommandDivergence_, 0.0);
+
+  // Promote the shadow controller
+  switchController(simpleControllerB_);
+  checkActiveController(simpleControllerB_);
+  ASSERT_FALSE(controllerManager_.getShadowReport(report));
+  cancelControllerManagerUpdate();
+}
+
+//! Controller commanding a constant value
+class CommandingController : public SimpleController {
+ protected:
+  bool advance(double /*dt*/) override {
+    getCommand().setValue(1.0);
+    return true;
+  }
+};
+
+TEST(ControllerAdapter, advancesInShadow) {  // NOLINT
+  auto state = std::make_shared<RocoState>();
+  auto command = std::make_shared<RocoCommand>();
+  ControllerAdapter<CommandingController, RocoState, RocoCommand> controller;
+  controller.setStateAndCommand(state, std::make_shared<boost::shared_mutex>(), command, std::make_shared<boost::shared_mutex>());
+  ASSERT_TRUE(controller.createController(0.001));
+
+  ASSERT_TRUE(controller.enterShadow(0.001));
+  ASSERT_TRUE(controller.isInShadow());
+  state->setValue(2.0 * RocoState::maxValue_);
+  ASSERT_TRUE(controller.advanceInShadow(0.001));  // Snapshot not published yet
+  controller.publishShadowSnapshot();
+  ASSERT_FALSE(controller.advanceInShadow(0.001));  // Bad state in snapshot
+  state->setValue(0.0);
+  controller.publishShadowSnapshot();
+  ASSERT_TRUE(controller.advanceInShadow(0.001));
+  ASSERT_DOUBLE_EQ(0.0, command->getValue());
+  ASSERT_DOUBLE_EQ(1.0, controller.getCommandDivergence());
+  command->setValue(0.5);
+  ASSERT_TRUE(controller.advanceInShadow(0.001));  // Compares to the live command, not to a snapshot of it
+  ASSERT_DOUBLE_EQ(0.5, controller.getCommandDivergence());
+
+  controller.leaveShadow();
+  ASSERT_FALSE(controller.isInShadow());
+  ASSERT_TRUE(controller.initializeController(0.001));
+  ASSERT_TRUE(controller.advanceController(0.001));
+  ASSERT_DOUBLE_EQ(1.0, command->getValue());
+  ASSERT_TRUE(controller.cleanupController());
+}
+
+}  // namespace rocoma
@@ -0,0 +1,138 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests for make-before-break switches and asynchronous stops of the controller manager.
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include "include/TestControllerManager.hpp"
+
+namespace rocoma {
+
+namespace {
+
+void enableMakeBeforeBreakSwitch(rocoma::ControllerManagerOptions& options) {
+  options.makeBeforeBreakSwitch = true;
+}
+
+void stopControllersAsynchronously(rocoma::ControllerManagerOptions& options) {
+  options.stopControllersAsynchronously = true;
+}
+
+//! Records the ticks it advanced in and stopped after, the ticks are counted over all instances
+class TickRecordingController : public SimpleController {
+ public:
+  static std::atomic<std::uint64_t> tick_;
+  std::atomic<std::uint64_t> firstTick_{0u};
+  std::atomic<std::uint64_t> lastTick_{0u};
+  std::atomic<std::uint64_t> stopTick_{0u};
+  std::atomic_bool isSwapStateTakenWhileAdvancing_{false};
+
+ protected:
+  bool advance(double /*dt*/) override {
+    isAdvancing_ = true;
+    const std::uint64_t tick = ++tick_;
+    if (firstTick_ == 0u) {
+      firstTick_ = tick;
+    }
+    lastTick_ = tick;
+    isAdvancing_ = false;
+    return true;
+  }
+  bool stop() override {
+    stopTick_ = tick_.load();
+    return true;
+  }
+  bool getSwapState(roco::ControllerSwapStateInterfacePtr& swapState) override {
+    isSwapStateTakenWhileAdvancing_ = isSwapStateTakenWhileAdvancing_ || isAdvancing_;
+    swapState.reset(nullptr);
+    return true;
+  }
+
+ private:
+  std::atomic_bool isAdvancing_{false};
+};
+
+std::atomic<std::uint64_t> TickRecordingController::tick_{0u};
+
+}  // namespace
+
+using TestControllerManagerMakeBeforeBreak = TestControllerManagerWithOptions<&enableMakeBeforeBreakSwitch>;
+using TestControllerManagerAsynchronousStop = TestControllerManagerWithOptions<&stopControllersAsynchronously>;
+
+TEST_F(TestControllerManagerMakeBeforeBreak, switchesWithoutUpdates) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerA_);
+  switchController(simpleControllerB_);
+  checkActiveController(simpleControllerB_);
+  emergencyStop();
+  checkActiveController(simpleEmergencyController_);
+}
+
+TEST_F(TestControllerManagerMakeBeforeBreak, switchesWhileUpdating) {  // NOLINT
+  runControllerManagerUpdateFor(0.05);
+  clearEstopAndSwitchController(simpleControllerA_);
+  switchController(sleepyControllerA_);
+  checkActiveController(sleepyControllerA_);
+  switchController(simpleControllerB_);
+  checkActiveController(simpleControllerB_);
+  emergencyStop();
+  clearEstopAndSwitchController(simpleControllerA_);
+  cancelControllerManagerUpdate();
+}
+
+TEST_F(TestControllerManagerMakeBeforeBreak, advancesOldControllerUntilFirstTickOfNewController) {  // NOLINT
+  using TickRecordingCtrl = ControllerAdapter<TickRecordingController, RocoState, RocoCommand>;
+  std::array<TickRecordingCtrl*, 2> controllers{{nullptr, nullptr}};
+  const std::array<std::string, 2> controllerNames{{"TickRecordingControllerA", "TickRecordingControllerB"}};
+  for (std::size_t i = 0u; i < controllers.size(); ++i) {
+    std::unique_ptr<TickRecordingCtrl> controller(new TickRecordingCtrl());
+    controller->setName(controllerNames[i]);
+    controller->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    controllers[i] = controller.get();
+    ASSERT_TRUE(controllerManager_.addControllerPair(std::move(controller), nullptr));
+  }
+  clearEstopAndSwitchController(controllerNames[0]);
+
+  runControllerManagerUpdateFor(0.1);
+  EXPECT_TRUE(waitUntil([&controllers]() { return controllers[0]->lastTick_ > 5u; }));
+  switchController(controllerNames[1]);
+  cancelControllerManagerUpdate();
+
+  // Every tick advanced one of the controllers, the old one was stopped after the first tick of the new one
+  EXPECT_NE(0u, controllers[1]->firstTick_.load());
+  EXPECT_EQ(controllers[0]->lastTick_ + 1u, controllers[1]->firstTick_);
+  EXPECT_GE(controllers[0]->stopTick_, controllers[1]->firstTick_);
+  EXPECT_FALSE(controllers[0]->isSwapStateTakenWhileAdvancing_);
+}
+
+TEST_F(TestControllerManagerAsynchronousStop, doesNotWaitForStopOnEstop) {  // NOLINT
+  clearEstopAndSwitchController(sleepyControllerA_);
+  const auto start = std::chrono::steady_clock::now();
+  emergencyStop();
+  ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(10));  // Sleepy controller takes 10 ms to stop
+  checkActiveController(simpleEmergencyController_);
+  ASSERT_TRUE(controllerManager_.updateController());
+
+  ASSERT_TRUE(controllerManager_.waitForStoppedControllers(1.0));
+  clearEstopAndSwitchController(sleepyControllerA_);
+}
+
+TEST(ControllerAdapter, waitsUntilStopped) {  // NOLINT
+  ControllerAdapter<SimpleController, RocoState, RocoCommand> controller;
+  ASSERT_TRUE(controller.waitUntilStopped(0.0));
+
+  controller.setIsBeingStopped(true);
+  ASSERT_FALSE(controller.waitUntilStopped(0.001));
+  std::thread stopper([&controller]() { controller.setIsBeingStopped(false); });
+  ASSERT_TRUE(controller.waitUntilStopped(1.0));
+  stopper.join();
+}
+
+}  // namespace rocoma
@@ -0,0 +1,190 @@
+/**
+ * @affiliation ANYbotics
+ * @brief       Tests for the timing statistics, deadlines and the tick driver of the controller manager.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+
+#include "include/TestControllerManager.hpp"
+
+namespace rocoma {
+
+namespace {
+
+void enableTimingStatistics(rocoma::ControllerManagerOptions& options) {
+  options.collectTimingStatistics = true;
+}
+
+void enableDeadlines(rocoma::ControllerManagerOptions& options, OverrunPolicy policy, double heartbeatTimeout) {
+  options.deadlineOptions.enable = true;
+  options.deadlineOptions.budgets["SimpleControllerB"] = 1.0e-9;
+  options.deadlineOptions.overrunPolicy = policy;
+  options.deadlineOptions.heartbeatTimeout = heartbeatTimeout;
+}
+
+void failproofStopOnOverrun(rocoma::ControllerManagerOptions& options) {
+  enableDeadlines(options, OverrunPolicy::FAILPROOF_STOP, 0.0);
+}
+
+void emergencyStopOnOverrun(rocoma::ControllerManagerOptions& options) {
+  enableDeadlines(options, OverrunPolicy::EMERGENCY_STOP, 0.0);
+}
+
+void enableHeartbeat(rocoma::ControllerManagerOptions& options) {
+  enableDeadlines(options, OverrunPolicy::COUNT, 0.005);
+}
+
+}  // namespace
+
+using TestControllerManagerTimings = TestControllerManagerWithOptions<&enableTimingStatistics>;
+using TestControllerManagerFailproofOnOverrun = TestControllerManagerWithOptions<&failproofStopOnOverrun>;
+using TestControllerManagerEmergencyOnOverrun = TestControllerManagerWithOptions<&emergencyStopOnOverrun>;
+using TestControllerManagerHeartbeat = TestControllerManagerWithOptions<&enableHeartbeat>;
+
+TEST_F(TestControllerManagerTimings, collectsTimingsOfActiveController) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerA_);
+  for (unsigned int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(controllerManager_.updateController());
+  }
+
+  ControllerTimingReport report;
+  ASSERT_TRUE(controllerManager_.getControllerTimingReport(simpleControllerA_, report));
+  ASSERT_EQ(10u, report.advanceController_.count);
+  ASSERT_TRUE(report.hasPhaseTimings_);
+  ASSERT_EQ(10u, report.advance_.count);
+  ASSERT_LE(report.advance_.p50, report.advance_.p999);
+  ASSERT_LE(report.advance_.p999, report.advance_.max);
+  ASSERT_EQ(10u, controllerManager_.getUpdateControllerTimingStatistics().count);
+  ASSERT_FALSE(controllerManager_.getControllerTimingReport("NotAController", report));
+}
+
+TEST_F(TestControllerManagerTimings, reportsRuntimeStatistics) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerA_);
+  for (unsigned int i = 0; i < 10; ++i) {
+    ASSERT_TRUE(controllerManager_.updateController());
+  }
+  emergencyStop();
+
+  const ControllerManagerStatistics statistics = controllerManager_.getStatistics();
+  ASSERT_EQ(10u, statistics.tickCount_);
+  ASSERT_EQ(10u, statistics.updateControllerLockWait_.count);
+  ASSERT_EQ(1u, statistics.switchController_.count);
+  ASSERT_GT(statistics.switchController_.last, 0.0);
+  ASSERT_EQ(1u, statistics.emergencyStop_.count);
+  auto controllerA =
+      std::find_if(statistics.controllers_.begin(), statistics.controllers_.end(),
+                   [this](const ControllerStatistics& controller) { return controller.controllerName_ == simpleControllerA_; });
+  ASSERT_NE(controllerA, statistics.controllers_.end());
+  ASSERT_EQ(10u, controllerA->numTicks_);
+  ASSERT_EQ(10u, controllerA->advanceController_.count);
+  ASSERT_EQ(simpleFailProofController_, statistics.controllers_.back().controllerName_);
+}
+
+TEST_F(TestControllerManagerTimings, reportsStatisticsWhileRegistering) {  // NOLINT
+  const std::size_t numControllersBefore = controllerManager_.getStatistics().controllers_.size();
+  std::atomic_bool isRegistering{true};
+  std::thread reader([this, &isRegistering]() {
+    while (isRegistering) {
+      controllerManager_.getStatistics();
+    }
+  });
+  for (unsigned int i = 0; i < 20; ++i) {
+    std::unique_ptr<SimpleCtrl> controller(new SimpleCtrl());
+    controller->setName("RegisteredController" + std::to_string(i));
+    controller->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    std::unique_ptr<EmergencyCtrl> emgcyController(new EmergencyCtrl());
+    emgcyController->setName("RegisteredEmergencyController" + std::to_string(i));
+    emgcyController->setStateAndCommand(state_, mutexState_, command_, mutexCommand_);
+    EXPECT_TRUE(controllerManager_.addControllerPair(std::move(controller), std::move(emgcyController)));
+  }
+  isRegistering = false;
+  reader.join();
+  ASSERT_EQ(numControllersBefore + 40u, controllerManager_.getStatistics().controllers_.size());
+}
+
+TEST_F(TestControllerManagerFailproofOnOverrun, stopsOnFirstOverrun) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerA_);
+  ASSERT_TRUE(controllerManager_.updateController());
+  checkActiveController(simpleControllerA_);
+
+  clearEstopAndSwitchController(simpleControllerB_);
+  ASSERT_TRUE(controllerManager_.updateController());
+  checkActiveController(simpleFailProofController_);
+}
+
+TEST_F(TestControllerManagerEmergencyOnOverrun, stopsAfterConsecutiveOverruns) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerB_);
+  ASSERT_TRUE(controllerManager_.updateController());
+  ASSERT_TRUE(controllerManager_.updateController());
+  checkActiveController(simpleControllerB_);
+  ASSERT_TRUE(controllerManager_.updateController());
+  checkActiveController(simpleEmergencyController_);
+
+  ControllerTimingReport report;
+  ASSERT_TRUE(controllerManager_.getControllerTimingReport(simpleControllerB_, report));
+  ASSERT_EQ(3u, report.advanceController_.count);
+  ASSERT_EQ(3u, report.advanceController_.overruns);
+}
+
+TEST_F(TestControllerManagerHeartbeat, stopsWhenUpdatesStall) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerA_);
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));  // Exceeds the heartbeat timeout
+  checkActiveController(simpleControllerA_);  // Not armed before the first update
+
+  ASSERT_TRUE(controllerManager_.updateController());
+  ASSERT_TRUE(waitUntil([this]() { return controllerManager_.getActiveControllerName() == simpleFailProofController_; }));
+}
+
+TEST_F(TestControllerManager, tickDriverUpdatesControllers) {  // NOLINT
+  clearEstopAndSwitchController(simpleControllerA_);
+  ASSERT_TRUE(controllerManager_.start());
+  ASSERT_FALSE(controllerManager_.start());
+  ASSERT_TRUE(waitUntil([this]() { return controllerManager_.getStatistics().tickCount_ > 10u; }));
+  switchController(simpleControllerB_);
+  controllerManager_.stop();
+
+  const TickDriverStatistics statistics = controllerManager_.getTickDriverStatistics();
+  ASSERT_GT(statistics.ticks, 10u);
+  ASSERT_EQ(0u, statistics.failedTicks);
+  ASSERT_EQ(statistics.ticks, statistics.wakeupLatency.count);
+  checkActiveController(simpleControllerB_);
+}
+
+TEST(TickDriver, runsUntilStoppedFromTick) {  // NOLINT
+  TickDriver* driver = nullptr;
+  unsigned int ticks = 0u;
+  TickDriver tickDriver(
+      [&driver, &ticks]() {
+        if (++ticks == 5u) {
+          driver->stop();
+        }
+        return true;
+      },
+      0.0005, TickDriverOptions());
+  driver = &tickDriver;
+
+  ASSERT_TRUE(tickDriver.run());
+  ASSERT_EQ(5u, ticks);
+  ASSERT_FALSE(tickDriver.isRunning());
+  ASSERT_EQ(5u, tickDriver.getStatistics().ticks);
+}
+
+TEST(LatencyHistogram, estimatesPercentiles) {  // NOLINT
+  LatencyHistogram histogram;
+  for (std::uint64_t i = 1; i <= 1000; ++i) {
+    histogram.record(i * 1000);
+  }
+  ASSERT_EQ(1000u, histogram.getCount());
+  ASSERT_EQ(1000000u, histogram.getMax());
+  ASSERT_NEAR(500000.0, histogram.getPercentile(0.5), 500000.0 * 0.125);
+  ASSERT_NEAR(990000.0, histogram.getPercentile(0.99), 990000.0 * 0.125);
+  ASSERT_DOUBLE_EQ(1000000.0, histogram.getPercentile(1.0));
+}
+
+}  // namespace rocoma
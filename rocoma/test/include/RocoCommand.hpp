@@ -9,6 +9,10 @@
 #include <message_logger/message_logger.hpp>
 #include <roco/model/CommandInterface.hpp>
 
+#include <cmath>
+
+#include "rocoma/controllers/CommandDivergence.hpp"
+
 namespace rocoma {
 
 class RocoCommand : public roco::CommandInterface {
@@ -31,4 +35,12 @@ class RocoCommand : public roco::CommandInterface {
   double value_ = 0.0;
 };
 
+template <>
+struct CommandDivergence<RocoCommand> {
+  static constexpr bool isDefined_ = true;
+  static double compute(const RocoCommand& shadowCommand, const RocoCommand& liveCommand) {
+    return std::abs(shadowCommand.getValue() - liveCommand.getValue());
+  }
+};
+
 }  // namespace rocoma
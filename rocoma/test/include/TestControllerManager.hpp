@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <chrono>
+#include <functional>
 #include <future>
 #include <thread>
 
@@ -33,7 +35,12 @@ class TestControllerManager : public ::testing::Test {
   using FailProofCtrl = rocoma::FailproofControllerAdapter<FailProofController, RocoState, RocoCommand>;
 
  public:
-  TestControllerManager()
+  //! Modifies the default options of the manager before initialization
+  using OptionsModifier = std::function<void(rocoma::ControllerManagerOptions&)>;
+
+  TestControllerManager() : TestControllerManager([](rocoma::ControllerManagerOptions& /*options*/) {}) {}
+
+  explicit TestControllerManager(const OptionsModifier& modifyOptions)
       : timeStep_(0.001),
         controllerManager_(),
         state_(new RocoState()),
@@ -43,7 +50,7 @@ class TestControllerManager : public ::testing::Test {
         updateThread_{},
         switchThread_{},
         estopFuture_{} {
-    setupSimpleControllerManager();
+    setupSimpleControllerManager(modifyOptions);
     setupSimpleControllers();
   }
 
@@ -90,7 +97,7 @@ class TestControllerManager : public ::testing::Test {
     controllerManager_.addControllerPair(std::move(preStopCheckControllerA), nullptr);
   }
 
-  void setupSimpleControllerManager() {
+  void setupSimpleControllerManager(const OptionsModifier& modifyOptions) {
     rocoma::ControllerManagerOptions managerOptions;
     managerOptions.isRealRobot = false;
     managerOptions.timeStep = timeStep_;
@@ -98,6 +105,7 @@ class TestControllerManager : public ::testing::Test {
     managerOptions.loggerOptions.enable = true;
     managerOptions.loggerOptions.fileTypes = {signal_logger::LogFileType::CSV};
     managerOptions.loggerOptions.updateOnStart = true;
+    modifyOptions(managerOptions);
     controllerManager_.init(managerOptions);
   }
 
@@ -159,6 +167,18 @@ class TestControllerManager : public ::testing::Test {
     }
   }
 
+  //! Polls the condition until it holds, @return false if it did not hold before the timeout [s]
+  static bool waitUntil(const std::function<bool()>& condition, double timeout = 5.0) {
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(static_cast<std::int64_t>(timeout * 1.0e6));
+    while (!condition()) {
+      if (std::chrono::steady_clock::now() >= deadline) {
+        return false;
+      }
+      std::this_thread::yield();
+    }
+    return true;
+  }
+
  private:
   void updateControllerManagerWorker(double seconds) {
     boost::asio::io_service io;
@@ -198,4 +218,11 @@ class TestControllerManager : public ::testing::Test {
   const __useconds_t threadStartupTimeInUS_{1000};
 };
 
+//! Fixture with options modified by a function, e.g. using TestControllerManagerX = TestControllerManagerWithOptions<&enableX>;
+template <void (*ModifyOptions_)(rocoma::ControllerManagerOptions&)>
+class TestControllerManagerWithOptions : public TestControllerManager {
+ public:
+  TestControllerManagerWithOptions() : TestControllerManager(ModifyOptions_) {}
+};
+
 }  // namespace rocoma
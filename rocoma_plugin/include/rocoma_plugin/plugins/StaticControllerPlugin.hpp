@@ -0,0 +1,88 @@
+/**********************************************************************
+ * Software License Agreement (BSD License)
+ *
+ * Copyright (c) 2014, Christian Gehring
+ * All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Autonomous Systems Lab nor ETH Zurich
+ *     nor the names of its contributors may be used to endorse or
+ *     promote products derived from this software without specific
+ *     prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+/*!
+ * @file     StaticControllerPlugin.hpp
+ * @date     Oct, 2026
+ */
+
+#pragma once
+
+// pluginlib
+#include <pluginlib/class_list_macros.h>
+
+// rocoma_plugin
+#include "rocoma_plugin/interfaces/ControllerPluginInterface.hpp"
+
+// rocoma
+#include "rocoma/controllers/StaticControllerAdapter.hpp"
+
+/*!
+ *   Export your controller as a StaticControllerPlugin in order to load it as a plugin.
+ *   The controller is advanced without virtual dispatch (see rocoma::StaticControllerAdapter).
+ *   This macro is a wrapper to PLUGINLIB_EXPORT_CLASS, for templated classes.
+ *   Protects typedefs in internal namespace.
+ */
+#define ROCOMA_EXPORT_STATIC_CONTROLLER(name, state, command, controller)           \
+  namespace plugin_##name_internal {                                                \
+    using name = rocoma_plugin::StaticControllerPlugin<controller, state, command>; \
+    using PluginBase = rocoma_plugin::ControllerPluginInterface<state, command>;    \
+    PLUGINLIB_EXPORT_CLASS(name, PluginBase)                                        \
+  }
+
+/*!
+ *   Same as ROCOMA_EXPORT_STATIC_CONTROLLER, with the policies of the adapter (e.g. rocoma::NoCheckPolicy,
+ *   rocoma::ManualTimePolicy, rocoma::PropagateExceptionPolicy).
+ */
+#define ROCOMA_EXPORT_STATIC_CONTROLLER_WITH_POLICIES(name, state, command, controller, checkPolicy, timePolicy, exceptionPolicy) \
+  namespace plugin_##name_internal {                                                                                              \
+    using name = rocoma_plugin::StaticControllerPlugin<controller, state, command, checkPolicy, timePolicy, exceptionPolicy>;     \
+    using PluginBase = rocoma_plugin::ControllerPluginInterface<state, command>;                                                  \
+    PLUGINLIB_EXPORT_CLASS(name, PluginBase)                                                                                      \
+  }
+
+namespace rocoma_plugin {
+
+//!  Plugin based static controller adapter.
+/*!
+ *   Export your controller as a StaticControllerPlugin in order to load it as a plugin.
+ *   The plugin is final, calls through it can be devirtualized.
+ */
+template <typename Controller_, typename State_, typename Command_, typename CheckPolicy_ = rocoma::RuntimeCheckPolicy,
+          typename TimePolicy_ = rocoma::WallTimePolicy, typename ExceptionPolicy_ = rocoma::DefaultExceptionPolicy>
+class StaticControllerPlugin final
+    : public rocoma::StaticControllerAdapter<Controller_, State_, Command_, CheckPolicy_, TimePolicy_, ExceptionPolicy_>,
+      public rocoma_plugin::ControllerPluginInterface<State_, Command_> {};
+
+} /* namespace rocoma_plugin */
@@ -53,5 +53,8 @@
 #include "rocoma_plugin/plugins/EmergencyControllerPlugin.hpp"
 #include "rocoma_plugin/plugins/EmergencyControllerRosPlugin.hpp"
 #include "rocoma_plugin/plugins/FailproofControllerPlugin.hpp"
+#include "rocoma_plugin/plugins/ParallelControllerTuplePlugin.hpp"
 #include "rocoma_plugin/plugins/SharedModulePlugin.hpp"
 #include "rocoma_plugin/plugins/SharedModuleRosPlugin.hpp"
+#include "rocoma_plugin/plugins/StaticControllerPlugin.hpp"
+#include "rocoma_plugin/plugins/StaticControllerTuplePlugin.hpp"
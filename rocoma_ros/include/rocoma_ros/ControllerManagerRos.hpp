@@ -2,16 +2,26 @@
 
 // rocoma
 #include "rocoma/ControllerManager.hpp"
+#include "rocoma/common/TripleBuffer.hpp"
 #include "rocoma/controllers/ControllerAdapter.hpp"
+#include "rocoma/controllers/CommandChannelInterface.hpp"
 
 // rocoma plugin
 #include "rocoma_plugin/rocoma_plugin.hpp"
 
+// rocoma ros
+#include "rocoma_ros/PackagePathCache.hpp"
+#include "rocoma_ros/PluginManifestIndex.hpp"
+#include "rocoma_ros/SetupPipeline.hpp"
+
 // rocoma msgs
 #include "rocoma_msgs/ControllerManagerState.h"
+#include "rocoma_msgs/ControllerManagerStatistics.h"
 #include "rocoma_msgs/EmergencyStop.h"
 #include "rocoma_msgs/GetActiveController.h"
 #include "rocoma_msgs/GetAvailableControllers.h"
+#include "rocoma_msgs/GetStatistics.h"
+#include "rocoma_msgs/ReloadController.h"
 #include "rocoma_msgs/SwitchController.h"
 
 // std msgs
@@ -32,7 +42,9 @@
 // stl
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace rocoma_ros {
@@ -81,6 +93,24 @@ struct ControllerManagerRosOptions : public rocoma::ControllerManagerOptions {
   ros::NodeHandle nodeHandle{};
 };
 
+//! Durations of the phases of setupControllersFromParameterServer [s]
+struct StartupReport {
+  //! Parsing the parameter server, overlaps with the setup of the parsed entries
+  double parseTime_{0.0};
+  //! Time the setup waited for the package paths (the packages are looked up concurrently while parsing)
+  double resolvePackagesTime_{0.0};
+  //! Number of distinct packages looked up with ros::package::getPath
+  unsigned int numPackageLookups_{0u};
+  //! Number of distinct plugin libraries read into the page cache while the plugins are instantiated
+  unsigned int numPrefetchedLibraries_{0u};
+  //! Setup of the failproof controller, the shared modules and the controller pairs (instantiation and creation on the setup thread)
+  double failproofControllerTime_{0.0};
+  double sharedModulesTime_{0.0};
+  double controllersTime_{0.0};
+  //! Duration of setupControllersFromParameterServer
+  double totalTime_{0.0};
+};
+
 //! Extension of the Controller Manager to ROS
 /*! Functionalities of the rocoma controller manager are wrapped as ros services.
  *  Controllers can be loaded using the ros pluginlib.
@@ -105,8 +135,8 @@ class ControllerManagerRos : public rocoma::ControllerManager {
   ControllerManagerRos(const std::string& scopedStateName, const std::string& scopedCommandName,
                        const ControllerManagerRosOptions& options);
 
-  //! Default destructor
-  ~ControllerManagerRos() override = default;
+  //! Destructor, stops the notifier thread before the publishers are destroyed
+  ~ControllerManagerRos() override;
 
   //! Init Manager and ROS publishers and services.
   virtual void init(const ControllerManagerRosOptions& options);
@@ -149,6 +179,25 @@ class ControllerManagerRos : public rocoma::ControllerManager {
                         std::shared_ptr<State_> state, std::shared_ptr<Command_> command, std::shared_ptr<boost::shared_mutex> mutexState,
                         std::shared_ptr<boost::shared_mutex> mutexCommand);
 
+  /*! Set the channel the controllers publish their command into (wait-free read by the hardware writer).
+   *  Has to be set before the controllers are set up. Controllers that are not rocoma adapters only use the command container.
+   * @param commandChannel  command channel (nullptr -> mutex protected command container only)
+   */
+  void setCommandChannel(std::shared_ptr<rocoma::TripleBuffer<Command_>> commandChannel) { commandChannel_ = commandChannel; }
+
+  /*! Replace a controller by a new instance of its plugin (see rocoma::ControllerManager::replaceController)
+   *  The instance is created in the calling thread, an active controller hands over with a make-before-break switch.
+   *  The plugin manifests are crawled again, plugins of packages built after the start can be loaded. A library that is still
+   *  loaded is not loaded again, the new instance then runs the previously loaded code (reported in the message). The library of
+   *  the previous plugin is unloaded once no instance of it remains, reload with a different plugin and back to run changed code.
+   * @param controllerName  name of a controller that was set up by this manager
+   * @param pluginName      name of the plugin of the new instance (empty -> plugin the controller was set up with)
+   * @param message         optional, result of the reload
+   * @returns true iff the controller was replaced
+   */
+  bool reloadController(const std::string& controllerName, const std::string& pluginName = std::string(),
+                        std::string* message = nullptr);
+
   /*! Add a vector of shared module pairs to the manager
    * @param sharedModuleOptions vector of shared module options
    * @returns true iff all shared modules were added successfully
@@ -188,6 +237,9 @@ class ControllerManagerRos : public rocoma::ControllerManager {
                                            std::shared_ptr<boost::shared_mutex> mutexState,
                                            std::shared_ptr<boost::shared_mutex> mutexCommand);
 
+  //! @returns durations of the phases of the last setupControllersFromParameterServer call
+  const StartupReport& getStartupReport() const { return startupReport_; }
+
   /*! Emergency stop service callback, triggers an emergency stop of the current controller
    * @param req   empty request
    * @param res   empty response
@@ -231,6 +283,20 @@ class ControllerManagerRos : public rocoma::ControllerManager {
    */
   bool getActiveControllerService(rocoma_msgs::GetActiveController::Request& req, rocoma_msgs::GetActiveController::Response& res);
 
+  /*! Get statistics service callback, returns the runtime statistics of the manager and its controllers
+   * @param req   empty request
+   * @param res   contains the statistics (read without locking the control loop)
+   * @return true iff successful
+   */
+  bool getStatisticsService(rocoma_msgs::GetStatistics::Request& req, rocoma_msgs::GetStatistics::Response& res);
+
+  /*! Reload controller service callback, replaces a controller by a new instance of its plugin
+   * @param req   contains name of the controller and optionally the name of the new plugin
+   * @param res   contains the result of the reload
+   * @return true iff successful
+   */
+  bool reloadControllerService(rocoma_msgs::ReloadController::Request& req, rocoma_msgs::ReloadController::Response& res);
+
   /*! Inform other nodes (via message) when an emergency stop was triggered
    * @param type   type of the emergency stop
    */
@@ -254,6 +320,49 @@ class ControllerManagerRos : public rocoma::ControllerManager {
   bool cleanup() override;
 
  private:
+  using ControllerLoader = pluginlib::ClassLoader<rocoma_plugin::ControllerPluginInterface<State_, Command_> >;
+  using ControllerRosLoader = pluginlib::ClassLoader<rocoma_plugin::ControllerRosPluginInterface<State_, Command_> >;
+
+  //! Options and robot containers a controller was instantiated with (used to reload it)
+  struct ControllerInstantiation {
+    ManagedControllerOptions options_;
+    std::shared_ptr<State_> state_;
+    std::shared_ptr<Command_> command_;
+    std::shared_ptr<boost::shared_mutex> mutexState_;
+    std::shared_ptr<boost::shared_mutex> mutexCommand_;
+    //! Generation of the controller class loaders the controller was instantiated with (see getControllerLoader)
+    std::size_t loaderGeneration_{0u};
+  };
+
+  /*! Get the controller class loaders of a generation (requires a lock on instantiationMutex_)
+   * @param generation  0 -> loaders constructed at the start, n -> loaders constructed by the n-th refresh with new description files
+   * @returns controller class loader
+   */
+  ControllerLoader& getControllerLoader(std::size_t generation) {
+    return generation == 0u ? controllerLoader_ : *refreshedControllerLoaders_[generation - 1u];
+  }
+  ControllerRosLoader& getControllerRosLoader(std::size_t generation) {
+    return generation == 0u ? controllerRosLoader_ : *refreshedControllerRosLoaders_[generation - 1u];
+  }
+
+  /*! Crawls the plugin manifests again and constructs a new generation of controller class loaders if description files were added.
+   *  Otherwise the newest loaders re-read their description files (requires a lock on instantiationMutex_).
+   */
+  void refreshControllerLoaders();
+
+  /*! Checks whether a controller class is loaded by any generation of the class loaders (requires a lock on instantiationMutex_)
+   * @param options  options containing the plugin name and the ros flag
+   * @returns true iff the library of the class is loaded, a new instance runs the loaded code
+   */
+  bool isControllerClassLoaded(const ManagedControllerOptions& options);
+
+  /*! Unloads the library of a replaced controller instance if no instantiation of its class remains (requires a lock on
+   *  instantiationMutex_, the replaced instance has to be destroyed)
+   * @param instantiation  instantiation of the replaced instance
+   * @returns true iff the library was unloaded
+   */
+  bool unloadUnusedControllerLibrary(const ControllerInstantiation& instantiation);
+
   /*! Publish the active controller.
    * @param activeController   active controller name
    */
@@ -268,6 +377,75 @@ class ControllerManagerRos : public rocoma::ControllerManager {
    */
   void publishEmergencyState(bool type);
 
+  /*! Publish the runtime statistics (throttled by the statistics timer, skipped without subscribers)
+   * @param event timer event
+   */
+  void publishStatistics(const ros::TimerEvent& event);
+
+  /*! Fill a statistics message from the counters of the manager
+   * @param statisticsMsg  statistics message
+   */
+  void fillStatisticsMsg(rocoma_msgs::ControllerManagerStatistics& statisticsMsg) const;
+
+  /*! Instantiate a controller pair from its plugins, the controllers are not created
+   * @param options         options containing names and ros flags
+   * @param state           robot state pointer
+   * @param command         robot command pointer
+   * @param mutexState      mutex protecting robot state pointer
+   * @param mutexCommand    mutex protecting robot command pointer
+   * @param controllerPair  instantiated controllers (emergency controller is nullptr if none or failed to load)
+   * @returns true iff the controller was instantiated
+   */
+  bool instantiateControllerPair(const ManagedControllerOptionsPair& options, std::shared_ptr<State_> state,
+                                 std::shared_ptr<Command_> command, std::shared_ptr<boost::shared_mutex> mutexState,
+                                 std::shared_ptr<boost::shared_mutex> mutexCommand, ControllerPairPtr& controllerPair);
+
+  /*! Instantiate a controller from its plugin, the controller is not created
+   * @param options         options containing names and ros flags
+   * @param state           robot state pointer
+   * @param command         robot command pointer
+   * @param mutexState      mutex protecting robot state pointer
+   * @param mutexCommand    mutex protecting robot command pointer
+   * @returns instantiated controller (throws pluginlib::PluginlibException if the plugin can not be loaded)
+   */
+  rocoma_plugin::ControllerPluginInterface<State_, Command_>* instantiateController(const ManagedControllerOptions& options,
+                                                                                    std::shared_ptr<State_> state,
+                                                                                    std::shared_ptr<Command_> command,
+                                                                                    std::shared_ptr<boost::shared_mutex> mutexState,
+                                                                                    std::shared_ptr<boost::shared_mutex> mutexCommand);
+
+  /*! Instantiate controller pairs serially and create them on up to maxCreationThreads threads (one by default)
+   * @param controllerOptions  options containing names and ros flags of all controller pairs
+   * @param state              robot state pointer
+   * @param command            robot command pointer
+   * @param mutexState         mutex protecting robot state pointer
+   * @param mutexCommand       mutex protecting robot command pointer
+   * @returns true iff all controllers were added successfully
+   */
+  bool setupControllerPairs(const std::vector<ManagedControllerOptionsPair>& controllerOptions, std::shared_ptr<State_> state,
+                            std::shared_ptr<Command_> command, std::shared_ptr<boost::shared_mutex> mutexState,
+                            std::shared_ptr<boost::shared_mutex> mutexCommand);
+
+  /*! Create instantiated controller pairs on up to maxCreationThreads threads and add them to the manager
+   * @param controllerPairs  instantiated controller pairs (ownership transfer)
+   * @returns true iff all controllers were created successfully
+   */
+  bool createControllerPairs(std::vector<ControllerPairPtr>&& controllerPairs);
+
+  /*! Parse the options of a controller, emergency controller or shared module from the parameter server (without copying the entry)
+   * @param module            entry of the module
+   * @param options           parsed options, the parameter path is relative to the parameter package
+   * @param parameterPackage  parsed parameter package
+   * @returns true iff all entries exist and have the right type
+   */
+  static bool parseModuleOptions(XmlRpc::XmlRpcValue& module, ManagedControllerOptions& options, std::string& parameterPackage);
+
+  /*! Set the command channel of a controller (if set and supported by the controller)
+   * @param controller  controller plugin
+   */
+  template <typename Controller>
+  void setupCommandChannel(Controller* controller);
+
  private:
   //! Init flag
   std::atomic_bool isInitializedRos_;
@@ -285,6 +463,10 @@ class ControllerManagerRos : public rocoma::ControllerManager {
   ros::ServiceServer getAvailableControllersService_;
   //! Get active controller service
   ros::ServiceServer getActiveControllerService_;
+  //! Get statistics service
+  ros::ServiceServer getStatisticsService_;
+  //! Reload controller service
+  ros::ServiceServer reloadControllerService_;
 
   //! Active controller publisher
   ros::Publisher activeControllerPublisher_;
@@ -301,6 +483,26 @@ class ControllerManagerRos : public rocoma::ControllerManager {
   //! Emergency state message
   rocoma_msgs::EmergencyStop emergencyStopStateMsg_;
 
+  //! Statistics publisher (only advertised if publishers/statistics/rate is positive)
+  ros::Publisher statisticsPublisher_;
+  //! Timer throttling the statistics publisher
+  ros::Timer statisticsTimer_;
+  //! Statistics message
+  rocoma_msgs::ControllerManagerStatistics statisticsMsg_;
+
+  //! Command channel passed to all controllers
+  std::shared_ptr<rocoma::TripleBuffer<Command_>> commandChannel_;
+
+  //! Paths of the parameter packages
+  PackagePathCache packagePathCache_;
+  //! Durations of the phases of setupControllersFromParameterServer
+  StartupReport startupReport_;
+
+  //! Instantiations of the controllers by controller name
+  std::unordered_map<std::string, ControllerInstantiation> controllerInstantiations_;
+  //! Mutex serializing the instantiation of controllers (the class loaders are not thread safe)
+  std::mutex instantiationMutex_;
+
   //! Failproof controller class loader
   pluginlib::ClassLoader<rocoma_plugin::FailproofControllerPluginInterface<State_, Command_> > failproofControllerLoader_;
   //! Emergency controller class loader
@@ -311,6 +513,12 @@ class ControllerManagerRos : public rocoma::ControllerManager {
   pluginlib::ClassLoader<rocoma_plugin::ControllerPluginInterface<State_, Command_> > controllerLoader_;
   //! Controller ROS class loader
   pluginlib::ClassLoader<rocoma_plugin::ControllerRosPluginInterface<State_, Command_> > controllerRosLoader_;
+  //! Controller class loaders constructed by reloads for description files added after the start (kept, they own the libraries of
+  //! their instances)
+  std::vector<std::unique_ptr<ControllerLoader> > refreshedControllerLoaders_;
+  std::vector<std::unique_ptr<ControllerRosLoader> > refreshedControllerRosLoaders_;
+  //! Sorted description files of the newest controller class loaders
+  std::vector<std::string> controllerPluginXmlPaths_;
   //! Shared module class loader
   pluginlib::ClassLoader<rocoma_plugin::SharedModulePluginInterface> sharedModuleLoader_;
   //! Shared module ROS class loader
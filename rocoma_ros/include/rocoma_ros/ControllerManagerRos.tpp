@@ -1,5 +1,8 @@
 #include <ros/package.h>
+#include <algorithm>
+#include <functional>
 #include <future>
+#include <unordered_set>
 #include <rocoma/ControllerManager.hpp>
 #include <rocoma_ros/ControllerManagerRos.hpp>
 
@@ -16,23 +19,51 @@ ControllerManagerRos<State_, Command_>::ControllerManagerRos(const std::string&
       clearEmergencyStopService_(),
       getAvailableControllersService_(),
       getActiveControllerService_(),
+      getStatisticsService_(),
+      reloadControllerService_(),
       activeControllerPublisher_(),
       activeControllerMsg_(),
       controllerManagerStatePublisher_(),
       controllerManagerStateMsg_(),
       emergencyStopStatePublisher_(),
       emergencyStopStateMsg_(),
+      statisticsPublisher_(),
+      statisticsTimer_(),
+      statisticsMsg_(),
+      commandChannel_(nullptr),
+      packagePathCache_(),
+      startupReport_(),
+      controllerInstantiations_(),
+      instantiationMutex_(),
       failproofControllerLoader_("rocoma_plugin",
-                                 "rocoma_plugin::FailproofControllerPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">"),
+                                 "rocoma_plugin::FailproofControllerPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">",
+                                 "plugin", PluginManifestIndex::getPluginXmlPaths()),
       emergencyControllerLoader_("rocoma_plugin",
-                                 "rocoma_plugin::EmergencyControllerPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">"),
+                                 "rocoma_plugin::EmergencyControllerPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">",
+                                 "plugin", PluginManifestIndex::getPluginXmlPaths()),
       emergencyControllerRosLoader_(
-          "rocoma_plugin", "rocoma_plugin::EmergencyControllerRosPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">"),
-      controllerLoader_("rocoma_plugin", "rocoma_plugin::ControllerPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">"),
+          "rocoma_plugin", "rocoma_plugin::EmergencyControllerRosPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">",
+          "plugin", PluginManifestIndex::getPluginXmlPaths()),
+      controllerLoader_("rocoma_plugin", "rocoma_plugin::ControllerPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">",
+                        "plugin", PluginManifestIndex::getPluginXmlPaths()),
       controllerRosLoader_("rocoma_plugin",
-                           "rocoma_plugin::ControllerRosPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">"),
-      sharedModuleLoader_("rocoma_plugin", "rocoma_plugin::SharedModulePluginInterface"),
-      sharedModuleRosLoader_("rocoma_plugin", "rocoma_plugin::SharedModuleRosPluginInterface") {}
+                           "rocoma_plugin::ControllerRosPluginInterface<" + scopedStateName + ", " + scopedCommandName + ">", "plugin",
+                           PluginManifestIndex::getPluginXmlPaths()),
+      refreshedControllerLoaders_(),
+      refreshedControllerRosLoaders_(),
+      controllerPluginXmlPaths_(PluginManifestIndex::getPluginXmlPaths()),
+      sharedModuleLoader_("rocoma_plugin", "rocoma_plugin::SharedModulePluginInterface", "plugin",
+                          PluginManifestIndex::getPluginXmlPaths()),
+      sharedModuleRosLoader_("rocoma_plugin", "rocoma_plugin::SharedModuleRosPluginInterface", "plugin",
+                             PluginManifestIndex::getPluginXmlPaths()) {
+  std::sort(controllerPluginXmlPaths_.begin(), controllerPluginXmlPaths_.end());
+}
+
+template <typename State_, typename Command_>
+ControllerManagerRos<State_, Command_>::~ControllerManagerRos() {
+  // The notifier thread calls the notify functions of this class, which publish
+  this->stopNotifier();
+}
 
 template <typename State_, typename Command_>
 ControllerManagerRos<State_, Command_>::ControllerManagerRos(const std::string& scopedStateName, const std::string& scopedCommandName,
@@ -71,6 +102,15 @@ void ControllerManagerRos<State_, Command_>::init(const ControllerManagerRosOpti
   getActiveControllerService_ =
       nodeHandle_.advertiseService(service_name_get_active_controller, &ControllerManagerRos::getActiveControllerService, this);
 
+  std::string service_name_get_statistics{"controller_manager/get_statistics"};
+  nodeHandle_.getParam("servers/get_statistics/service", service_name_get_statistics);
+  getStatisticsService_ = nodeHandle_.advertiseService(service_name_get_statistics, &ControllerManagerRos::getStatisticsService, this);
+
+  std::string service_name_reload_controller{"controller_manager/reload_controller"};
+  nodeHandle_.getParam("servers/reload_controller/service", service_name_reload_controller);
+  reloadControllerService_ =
+      nodeHandle_.advertiseService(service_name_reload_controller, &ControllerManagerRos::reloadControllerService, this);
+
   std::string service_name_emergency_stop{"controller_manager/emergency_stop"};
   nodeHandle_.getParam("servers/emergency_stop/service", service_name_emergency_stop);
   emergencyStopService_ = nodeHandle_.advertiseService(service_name_emergency_stop, &ControllerManagerRos::emergencyStopService, this);
@@ -101,6 +141,16 @@ void ControllerManagerRos<State_, Command_>::init(const ControllerManagerRosOpti
   emergencyStopStatePublisher_ = nodeHandle_.advertise<rocoma_msgs::EmergencyStop>(topic_name_notify_emergency_stop, 1, true);
   publishEmergencyState(false);
 
+  // Statistics are read from lock-free counters of the manager, publishing does not interfere with the control loop
+  double statistics_rate{0.0};
+  nodeHandle_.getParam("publishers/statistics/rate", statistics_rate);
+  if (statistics_rate > 0.0) {
+    std::string topic_name_statistics{"controller_manager/statistics"};
+    nodeHandle_.getParam("publishers/statistics/topic", topic_name_statistics);
+    statisticsPublisher_ = nodeHandle_.advertise<rocoma_msgs::ControllerManagerStatistics>(topic_name_statistics, 1);
+    statisticsTimer_ = nodeHandle_.createTimer(ros::Duration(1.0 / statistics_rate), &ControllerManagerRos::publishStatistics, this);
+  }
+
   // Set init flag
   isInitializedRos_ = true;
 }
@@ -110,57 +160,140 @@ void ControllerManagerRos<State_, Command_>::shutdown() {
   switchControllerService_.shutdown();
   getAvailableControllersService_.shutdown();
   getActiveControllerService_.shutdown();
+  getStatisticsService_.shutdown();
+  reloadControllerService_.shutdown();
   emergencyStopService_.shutdown();
   failproofStopService_.shutdown();
   clearEmergencyStopService_.shutdown();
   controllerManagerStatePublisher_.shutdown();
   emergencyStopStatePublisher_.shutdown();
   activeControllerPublisher_.shutdown();
+  statisticsTimer_.stop();
+  statisticsPublisher_.shutdown();
 }
 
 template <typename State_, typename Command_>
 bool ControllerManagerRos<State_, Command_>::cleanup() {
-  bool success = rocoma::ControllerManager::cleanup();
+  // The statistics timer and the services access the controllers, shut them down before the controllers are released.
+  // Pending notifications are published before the publishers are shut down.
+  this->stopNotifier();
   shutdown();
-  return success;
+  return rocoma::ControllerManager::cleanup();
 }
 
 template <typename State_, typename Command_>
-bool ControllerManagerRos<State_, Command_>::setupControllerPair(const ManagedControllerOptionsPair& options, std::shared_ptr<State_> state,
-                                                                 std::shared_ptr<Command_> command,
-                                                                 std::shared_ptr<boost::shared_mutex> mutexState,
-                                                                 std::shared_ptr<boost::shared_mutex> mutexCommand) {
-  if (!isInitializedRos_) {
-    MELO_ERROR("[RocomaRos] Not initialized. Can not setup controller.");
-    return false;
-  }
-  //--- Add controller
+rocoma_plugin::ControllerPluginInterface<State_, Command_>* ControllerManagerRos<State_, Command_>::instantiateController(
+    const ManagedControllerOptions& options, std::shared_ptr<State_> state, std::shared_ptr<Command_> command,
+    std::shared_ptr<boost::shared_mutex> mutexState, std::shared_ptr<boost::shared_mutex> mutexCommand) {
+  // Instantiate with the newest class loaders
+  const std::size_t loaderGeneration = refreshedControllerLoaders_.size();
   rocoma_plugin::ControllerPluginInterface<State_, Command_>* controller;
+  if (options.isRos_) {
+    // Instantiate controller
+    rocoma_plugin::ControllerRosPluginInterface<State_, Command_>* rosController =
+        getControllerRosLoader(loaderGeneration).createUnmanagedInstance(options.pluginName_);
+    // Set node handle
+    rosController->setNodeHandle(nodeHandle_);
+    controller = rosController;
+  } else {
+    controller = getControllerLoader(loaderGeneration).createUnmanagedInstance(options.pluginName_);
+  }
 
-  try {
-    if (options.first.isRos_) {
-      // Instantiate controller
-      rocoma_plugin::ControllerRosPluginInterface<State_, Command_>* rosController =
-          controllerRosLoader_.createUnmanagedInstance(options.first.pluginName_);
-      // Set node handle
-      rosController->setNodeHandle(nodeHandle_);
-      controller = rosController;
+  // Set state and command
+  controller->setName(options.name_);
+  controller->setStateAndCommand(state, mutexState, command, mutexCommand);
+  setupCommandChannel(controller);
+  controller->setParameterPath(options.parameterPath_);
+  for (auto& sharedModuleName : options.sharedModuleNames_) {
+    if (this->hasSharedModule(sharedModuleName)) {
+      controller->addSharedModule(sharedModules_.at(sharedModuleName));
     } else {
-      controller = controllerLoader_.createUnmanagedInstance(options.first.pluginName_);
+      MELO_WARN("[RocomaRos] Shared module %s does not exist. Failed to add it to the controller %s.", sharedModuleName.c_str(),
+                controller->getName().c_str());
     }
+  }
 
-    // Set state and command
-    controller->setName(options.first.name_);
-    controller->setStateAndCommand(state, mutexState, command, mutexCommand);
-    controller->setParameterPath(options.first.parameterPath_);
-    for (auto& sharedModuleName : options.first.sharedModuleNames_) {
-      if (this->hasSharedModule(sharedModuleName)) {
-        controller->addSharedModule(sharedModules_.at(sharedModuleName));
-      } else {
-        MELO_WARN("[RocomaRos] Shared module %s does not exist. Failed to add it to the controller %s.", sharedModuleName.c_str(),
-                  controller->getName().c_str());
-      }
+  // Remember the instantiation for reloads
+  ControllerInstantiation& instantiation = controllerInstantiations_[options.name_];
+  instantiation.options_ = options;
+  instantiation.state_ = state;
+  instantiation.command_ = command;
+  instantiation.mutexState_ = mutexState;
+  instantiation.mutexCommand_ = mutexCommand;
+  instantiation.loaderGeneration_ = loaderGeneration;
+  return controller;
+}
+
+template <typename State_, typename Command_>
+void ControllerManagerRos<State_, Command_>::refreshControllerLoaders() {
+  std::vector<std::string> pluginXmlPaths = PluginManifestIndex::crawlPluginXmlPaths();
+  std::sort(pluginXmlPaths.begin(), pluginXmlPaths.end());
+  const std::size_t loaderGeneration = refreshedControllerLoaders_.size();
+  if (pluginXmlPaths.empty() || pluginXmlPaths == controllerPluginXmlPaths_) {
+    // Same description files, the loaders pick up the classes added to them
+    getControllerLoader(loaderGeneration).refreshDeclaredClasses();
+    getControllerRosLoader(loaderGeneration).refreshDeclaredClasses();
+    return;
+  }
+
+  // The description files are fixed on construction, the older loaders are kept for the instances they loaded
+  refreshedControllerLoaders_.emplace_back(
+      new ControllerLoader("rocoma_plugin", controllerLoader_.getBaseClassType(), "plugin", pluginXmlPaths));
+  refreshedControllerRosLoaders_.emplace_back(
+      new ControllerRosLoader("rocoma_plugin", controllerRosLoader_.getBaseClassType(), "plugin", pluginXmlPaths));
+  controllerPluginXmlPaths_ = pluginXmlPaths;
+  MELO_INFO("[RocomaRos] Found %zu rocoma plugin manifests after the start, constructed generation %zu of the controller class loaders.",
+            pluginXmlPaths.size(), refreshedControllerLoaders_.size());
+}
+
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::isControllerClassLoaded(const ManagedControllerOptions& options) {
+  for (std::size_t generation = 0u; generation <= refreshedControllerLoaders_.size(); ++generation) {
+    if (options.isRos_ ? getControllerRosLoader(generation).isClassLoaded(options.pluginName_)
+                       : getControllerLoader(generation).isClassLoaded(options.pluginName_)) {
+      return true;
     }
+  }
+  return false;
+}
+
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::unloadUnusedControllerLibrary(const ControllerInstantiation& instantiation) {
+  const ManagedControllerOptions& options = instantiation.options_;
+  for (const auto& remainingInstantiation : controllerInstantiations_) {
+    const ControllerInstantiation& remaining = remainingInstantiation.second;
+    if (remaining.options_.isRos_ == options.isRos_ && remaining.options_.pluginName_ == options.pluginName_ &&
+        remaining.loaderGeneration_ == instantiation.loaderGeneration_) {
+      return false;
+    }
+  }
+
+  try {
+    const int numPendingUnloads = options.isRos_
+                                      ? getControllerRosLoader(instantiation.loaderGeneration_).unloadLibraryForClass(options.pluginName_)
+                                      : getControllerLoader(instantiation.loaderGeneration_).unloadLibraryForClass(options.pluginName_);
+    MELO_INFO("[RocomaRos] No instance of plugin %s remains, unloaded its library (%d pending unloads).", options.pluginName_.c_str(),
+              numPendingUnloads);
+    return numPendingUnloads == 0;
+  } catch (pluginlib::PluginlibException& ex) {
+    MELO_WARN("[RocomaRos] Could not unload the library of plugin %s. Error: %s", options.pluginName_.c_str(), ex.what());
+    return false;
+  }
+}
+
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::instantiateControllerPair(const ManagedControllerOptionsPair& options,
+                                                                       std::shared_ptr<State_> state, std::shared_ptr<Command_> command,
+                                                                       std::shared_ptr<boost::shared_mutex> mutexState,
+                                                                       std::shared_ptr<boost::shared_mutex> mutexCommand,
+                                                                       ControllerPairPtr& controllerPair) {
+  std::lock_guard<std::mutex> lockInstantiation(instantiationMutex_);
+
+  //--- Instantiate controller
+  rocoma_plugin::ControllerPluginInterface<State_, Command_>* controller;
+
+  try {
+    controller = instantiateController(options.first, state, command, mutexState, mutexCommand);
   } catch (pluginlib::PluginlibException& ex) {
     // handle the class failing to load
     MELO_ERROR("[RocomaRos] The plugin failed to load for some reason. Error: %s", ex.what());
@@ -196,6 +329,7 @@ bool ControllerManagerRos<State_, Command_>::setupControllerPair(const ManagedCo
       // Set state and command
       emgcyController->setName(options.second.name_);
       emgcyController->setStateAndCommand(state, mutexState, command, mutexCommand);
+      setupCommandChannel(emgcyController);
       emgcyController->setParameterPath(options.second.parameterPath_);
       for (auto& sharedModuleName : options.second.sharedModuleNames_) {
         if (this->hasSharedModule(sharedModuleName)) {
@@ -215,12 +349,32 @@ bool ControllerManagerRos<State_, Command_>::setupControllerPair(const ManagedCo
     }
   }  // endif
 
+  controllerPair.first.reset(controller);
+  controllerPair.second.reset(emgcyController);
+  return true;
+}
+
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::setupControllerPair(const ManagedControllerOptionsPair& options, std::shared_ptr<State_> state,
+                                                                 std::shared_ptr<Command_> command,
+                                                                 std::shared_ptr<boost::shared_mutex> mutexState,
+                                                                 std::shared_ptr<boost::shared_mutex> mutexCommand) {
+  if (!isInitializedRos_) {
+    MELO_ERROR("[RocomaRos] Not initialized. Can not setup controller.");
+    return false;
+  }
+
+  // Instantiate controllers
+  ControllerPairPtr controllerPair;
+  if (!instantiateControllerPair(options, state, command, mutexState, mutexCommand, controllerPair)) {
+    return false;
+  }
+
   // Set name to failproof if nullptr
-  std::string emergencyControllerName = (emgcyController == nullptr) ? "FailproofController" : options.second.name_;
+  std::string emergencyControllerName = (controllerPair.second == nullptr) ? "FailproofController" : options.second.name_;
 
   // Add controller to the manager
-  if (!this->addControllerPair(std::unique_ptr<roco::ControllerAdapterInterface>(controller),
-                               std::unique_ptr<roco::EmergencyControllerAdapterInterface>(emgcyController))) {
+  if (!this->addControllerPair(std::move(controllerPair.first), std::move(controllerPair.second))) {
     MELO_WARN_STREAM("[RocomaRos] Could not add controller pair ( " << options.first.name_ << " / " << emergencyControllerName
                                                                     << " ) to controller manager!");
     return false;
@@ -233,6 +387,93 @@ bool ControllerManagerRos<State_, Command_>::setupControllerPair(const ManagedCo
   return true;
 }
 
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::reloadController(const std::string& controllerName, const std::string& pluginName,
+                                                              std::string* message) {
+  std::string result;
+  const auto reportResult = [&result, message](bool success) -> bool {
+    if (message != nullptr) {
+      *message = result;
+    }
+    return success;
+  };
+  if (!isInitializedRos_) {
+    MELO_ERROR("[RocomaRos] Not initialized. Can not reload controller.");
+    result = "Not initialized.";
+    return reportResult(false);
+  }
+
+  // Instantiate the new instance, the old one keeps running
+  ControllerPtr controller;
+  ControllerInstantiation previousInstantiation;
+  std::string newPluginName;
+  bool isClassLoaded = false;
+  {
+    std::lock_guard<std::mutex> lockInstantiation(instantiationMutex_);
+    auto instantiation = controllerInstantiations_.find(controllerName);
+    if (instantiation == controllerInstantiations_.end()) {
+      MELO_WARN("[RocomaRos] Controller %s was not set up by the controller manager. Can not reload it.", controllerName.c_str());
+      result = "Controller was not set up by the controller manager.";
+      return reportResult(false);
+    }
+    previousInstantiation = instantiation->second;
+    ManagedControllerOptions options = previousInstantiation.options_;
+    if (!pluginName.empty()) {
+      options.pluginName_ = pluginName;
+    }
+    newPluginName = options.pluginName_;
+
+    try {
+      // Pick up plugins of packages built after the start and plugins added to the description files
+      refreshControllerLoaders();
+      // A library that is still loaded is not loaded again
+      isClassLoaded = isControllerClassLoaded(options);
+      controller.reset(instantiateController(options, previousInstantiation.state_, previousInstantiation.command_,
+                                             previousInstantiation.mutexState_, previousInstantiation.mutexCommand_));
+    } catch (pluginlib::PluginlibException& ex) {
+      MELO_ERROR("[RocomaRos] The plugin failed to load for some reason. Error: %s", ex.what());
+      MELO_WARN_STREAM("[RocomaRos] Could not reload controller: " << controllerName << "!");
+      controllerInstantiations_[controllerName] = previousInstantiation;
+      result = std::string("The plugin failed to load: ") + ex.what();
+      return reportResult(false);
+    }
+  }
+
+  // Create and exchange the instance
+  if (!this->replaceController(std::move(controller))) {
+    std::lock_guard<std::mutex> lockInstantiation(instantiationMutex_);
+    controllerInstantiations_[controllerName] = previousInstantiation;
+    MELO_WARN_STREAM("[RocomaRos] Could not reload controller: " << controllerName << "!");
+    result = "Could not create or hand over to the new instance, the old one is kept.";
+    return reportResult(false);
+  }
+
+  // The replaced instance is destroyed, its library is unloaded unless another instance uses it
+  bool isPreviousLibraryUnloaded = false;
+  {
+    std::lock_guard<std::mutex> lockInstantiation(instantiationMutex_);
+    isPreviousLibraryUnloaded = unloadUnusedControllerLibrary(previousInstantiation);
+  }
+
+  // Inform user
+  if (isClassLoaded) {
+    MELO_WARN(
+        "[RocomaRos] Reloaded controller %s, but plugin %s was still loaded. The new instance runs the previously loaded code. Reload "
+        "with a different plugin and back to run a rebuilt library.",
+        controllerName.c_str(), newPluginName.c_str());
+    result = "Reloaded, but plugin " + newPluginName +
+             " was still loaded: the new instance runs the previously loaded code. Reload with a different plugin and back to run a "
+             "rebuilt library.";
+  } else {
+    MELO_INFO_STREAM("[RocomaRos] Successfully reloaded controller: " << controllerName << "!");
+    result = "Reloaded from a newly loaded library of plugin " + newPluginName + ".";
+  }
+  if (isPreviousLibraryUnloaded) {
+    result += " Unloaded the library of plugin " + previousInstantiation.options_.pluginName_ + ".";
+  }
+  return reportResult(true);
+}
+
 template <typename State_, typename Command_>
 bool ControllerManagerRos<State_, Command_>::setupFailproofController(const std::string& controllerPluginName,
                                                                       std::shared_ptr<State_> state, std::shared_ptr<Command_> command,
@@ -244,11 +485,15 @@ bool ControllerManagerRos<State_, Command_>::setupFailproofController(const std:
   }
   try {
     // Instantiate controller
-    rocoma_plugin::FailproofControllerPluginInterface<State_, Command_>* controller =
-        failproofControllerLoader_.createUnmanagedInstance(controllerPluginName);
+    rocoma_plugin::FailproofControllerPluginInterface<State_, Command_>* controller;
+    {
+      std::lock_guard<std::mutex> lockInstantiation(instantiationMutex_);
+      controller = failproofControllerLoader_.createUnmanagedInstance(controllerPluginName);
+    }
 
     // Set state and command
     controller->setStateAndCommand(state, mutexState, command, mutexCommand);
+    setupCommandChannel(controller);
 
     // Add controller to the manager
     if (!this->setFailproofController(std::unique_ptr<rocoma_plugin::FailproofControllerPluginInterface<State_, Command_> >(controller))) {
@@ -282,12 +527,46 @@ bool ControllerManagerRos<State_, Command_>::setupControllers(const std::string&
 
   // add failproof controller to manager
   bool success = setupFailproofController(failproofControllerName, state, command, mutexState, mutexCommand);
+  return setupControllerPairs(controllerNameMap, state, command, mutexState, mutexCommand) && success;
+}
 
-  // add emergency controllers to manager
-  for (auto& controllerPair : controllerNameMap) {
-    success = setupControllerPair(controllerPair, state, command, mutexState, mutexCommand) && success;
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::setupControllerPairs(const std::vector<ManagedControllerOptionsPair>& controllerNameMap,
+                                                                  std::shared_ptr<State_> state, std::shared_ptr<Command_> command,
+                                                                  std::shared_ptr<boost::shared_mutex> mutexState,
+                                                                  std::shared_ptr<boost::shared_mutex> mutexCommand) {
+  bool success = true;
+
+  // instantiate the plugins serially, the class loaders are not thread safe
+  std::vector<ControllerPairPtr> controllerPairs;
+  controllerPairs.reserve(controllerNameMap.size());
+  for (auto& controllerOptions : controllerNameMap) {
+    ControllerPairPtr controllerPair;
+    if (instantiateControllerPair(controllerOptions, state, command, mutexState, mutexCommand, controllerPair)) {
+      controllerPairs.push_back(std::move(controllerPair));
+    } else {
+      success = false;
+    }
   }
 
+  return createControllerPairs(std::move(controllerPairs)) && success;
+}
+
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::createControllerPairs(std::vector<ControllerPairPtr>&& controllerPairs) {
+  if (controllerPairs.empty()) {
+    return true;
+  }
+
+  // create the controllers on up to maxCreationThreads threads (one by default, create() need not be thread safe)
+  std::vector<rocoma::ControllerCreationResult> results;
+  const bool success = this->addControllerPairs(std::move(controllerPairs), &results);
+  for (const auto& result : results) {
+    if (!result.success_) {
+      MELO_WARN_STREAM("[RocomaRos] Could not create " << (result.isEmergencyController_ ? "emergency controller " : "controller ")
+                                                       << result.controllerName_ << "!");
+    }
+  }
   return success;
 }
 
@@ -301,6 +580,7 @@ bool ControllerManagerRos<State_, Command_>::setupSharedModules(const std::vecto
   // add emergency controllers to manager
   for (auto& sharedModuleOption : sharedModuleOptions) {
     roco::SharedModule* sharedModule;
+    std::unique_lock<std::mutex> lockInstantiation(instantiationMutex_);
     if (sharedModuleOption.isRos_) {
       roco_ros::SharedModuleRos* sharedModuleRos = sharedModuleRosLoader_.createUnmanagedInstance(sharedModuleOption.pluginName_);
       sharedModuleRos->setNodeHandle(nodeHandle_);
@@ -308,6 +588,7 @@ bool ControllerManagerRos<State_, Command_>::setupSharedModules(const std::vecto
     } else {
       sharedModule = sharedModuleLoader_.createUnmanagedInstance(sharedModuleOption.pluginName_);
     }
+    lockInstantiation.unlock();
     sharedModule->setName(sharedModuleOption.name_);
     sharedModule->setParameterPath(sharedModuleOption.parameterPath_);
     if (sharedModule->create(options_.timeStep)) {
@@ -320,6 +601,35 @@ bool ControllerManagerRos<State_, Command_>::setupSharedModules(const std::vecto
   return true;
 }
 
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::parseModuleOptions(XmlRpc::XmlRpcValue& module, ManagedControllerOptions& options,
+                                                                std::string& parameterPackage) {
+  // Check for data members
+  if (!(module.hasMember("plugin_name") && module["plugin_name"].getType() == XmlRpc::XmlRpcValue::TypeString &&
+        module.hasMember("name") && module["name"].getType() == XmlRpc::XmlRpcValue::TypeString && module.hasMember("is_ros") &&
+        module["is_ros"].getType() == XmlRpc::XmlRpcValue::TypeBoolean && module.hasMember("parameter_package") &&
+        module["parameter_package"].getType() == XmlRpc::XmlRpcValue::TypeString && module.hasMember("parameter_path") &&
+        module["parameter_path"].getType() == XmlRpc::XmlRpcValue::TypeString)) {
+    return false;
+  }
+
+  options.pluginName_ = static_cast<std::string&>(module["plugin_name"]);
+  options.name_ = static_cast<std::string&>(module["name"]);
+  options.isRos_ = static_cast<bool&>(module["is_ros"]);
+  parameterPackage = static_cast<std::string&>(module["parameter_package"]);
+  options.parameterPath_ = static_cast<std::string&>(module["parameter_path"]);
+  options.sharedModuleNames_.clear();
+  if (module.hasMember("shared_modules") && module["shared_modules"].getType() == XmlRpc::XmlRpcValue::TypeArray) {
+    XmlRpc::XmlRpcValue& sharedModules = module["shared_modules"];
+    for (int j = 0; j < sharedModules.size(); ++j) {
+      if (sharedModules[j].getType() == XmlRpc::XmlRpcValue::TypeString) {
+        options.sharedModuleNames_.push_back(static_cast<std::string&>(sharedModules[j]));
+      }
+    }
+  }
+  return true;
+}
+
 template <typename State_, typename Command_>
 bool ControllerManagerRos<State_, Command_>::setupControllersFromParameterServer(std::shared_ptr<State_> state,
                                                                                  std::shared_ptr<Command_> command,
@@ -329,6 +639,11 @@ bool ControllerManagerRos<State_, Command_>::setupControllersFromParameterServer
     MELO_ERROR("[RocomaRos] Not initialized. Can not setup controllers from parameter server.");
     return false;
   }
+  startupReport_ = StartupReport();
+  const rocoma::TimingClock::time_point start = rocoma::TimingClock::now();
+  const auto secondsSince = [](const rocoma::TimingClock::time_point& since) -> double {
+    return static_cast<double>(rocoma::nanosecondsSince(since)) * 1.0e-9;
+  };
 
   // Parse failproof controller name
   std::string failproofControllerName;
@@ -338,12 +653,42 @@ bool ControllerManagerRos<State_, Command_>::setupControllersFromParameterServer
     return false;
   }
 
-  // Parse shared module list
-  std::vector<ManagedModuleOptions> shared_module_option_list;
-  ManagedModuleOptions shared_module_option;
-  XmlRpc::XmlRpcValue shared_module_list;
-  XmlRpc::XmlRpcValue shared_module;
+  //--- Set up every entry on the setup thread as soon as it is parsed. Its package is looked up and its plugin library is read into
+  //    the page cache concurrently, the setup thread instantiates one plugin at a time and waits only for the package at hand.
+  bool success = true;
+  std::unordered_set<std::string> libraryPaths;
+  std::vector<std::future<void>> prefetches;
+  const auto prefetchLibrary = [this, &libraryPaths, &prefetches](const std::function<std::string()>& getLibraryPath) {
+    std::string libraryPath;
+    {
+      // The class loaders are not thread safe
+      std::lock_guard<std::mutex> lockInstantiation(instantiationMutex_);
+      libraryPath = getLibraryPath();
+    }
+    if (libraryPaths.insert(libraryPath).second) {
+      for (auto& prefetch : PluginManifestIndex::prefetchLibraries({libraryPath})) {
+        prefetches.push_back(std::move(prefetch));
+      }
+    }
+  };
+  const auto makeParameterPath = [this, &secondsSince](const std::shared_future<std::string>& packagePath, std::string& parameterPath) {
+    const rocoma::TimingClock::time_point waitStart = rocoma::TimingClock::now();
+    parameterPath = packagePath.get() + "/" + parameterPath;
+    startupReport_.resolvePackagesTime_ += secondsSince(waitStart);
+  };
+  std::vector<ControllerPairPtr> controllerPairs;
+  SetupPipeline pipeline;
 
+  // add failproof controller to manager
+  prefetchLibrary([this, &failproofControllerName]() { return failproofControllerLoader_.getClassLibraryPath(failproofControllerName); });
+  pipeline.post([this, &success, &secondsSince, failproofControllerName, state, command, mutexState, mutexCommand]() {
+    const rocoma::TimingClock::time_point stepStart = rocoma::TimingClock::now();
+    success = setupFailproofController(failproofControllerName, state, command, mutexState, mutexCommand) && success;
+    startupReport_.failproofControllerTime_ = secondsSince(stepStart);
+  });
+
+  // Setup shared modules, the parameter paths are relative to their packages
+  XmlRpc::XmlRpcValue shared_module_list;
   if (nodeHandle_.getParam("controller_manager/shared_modules", shared_module_list)) {
     if (shared_module_list.getType() == XmlRpc::XmlRpcValue::TypeArray) {
       for (int i = 0; i < shared_module_list.size(); ++i) {
@@ -354,150 +699,144 @@ bool ControllerManagerRos<State_, Command_>::setupControllersFromParameterServer
           continue;
         }
 
-        shared_module = shared_module_list[i]["shared_module"];
-
-        // Check for data members
-        if (shared_module.hasMember("plugin_name") && shared_module["plugin_name"].getType() == XmlRpc::XmlRpcValue::TypeString &&
-            shared_module.hasMember("name") && shared_module["name"].getType() == XmlRpc::XmlRpcValue::TypeString &&
-            shared_module.hasMember("is_ros") && shared_module["is_ros"].getType() == XmlRpc::XmlRpcValue::TypeBoolean &&
-            shared_module.hasMember("parameter_package") &&
-            shared_module["parameter_package"].getType() == XmlRpc::XmlRpcValue::TypeString && shared_module.hasMember("parameter_path") &&
-            shared_module["parameter_path"].getType() == XmlRpc::XmlRpcValue::TypeString) {
-          shared_module_option.pluginName_ = static_cast<std::string>(shared_module["plugin_name"]);
-          shared_module_option.name_ = static_cast<std::string>(shared_module["name"]);
-          shared_module_option.isRos_ = static_cast<bool>(shared_module["is_ros"]);
-          std::string parameterPackage = static_cast<std::string>(shared_module["parameter_package"]);
-          if (!parameterPackage.empty()) {
-            parameterPackage = ros::package::getPath(parameterPackage);
-          }
-          shared_module_option.parameterPath_ = parameterPackage + "/" + static_cast<std::string>(shared_module["parameter_path"]);
-          MELO_INFO(
-              "[RocomaRos] Got shared module %s successfully from the parameter server. \n (is_ros: %s, complete parameter_path: %s!)",
-              shared_module_option.pluginName_.c_str(), shared_module_option.isRos_ ? "true" : "false",
-              shared_module_option.parameterPath_.c_str());
-          shared_module_option_list.push_back(shared_module_option);
-        } else {
+        ManagedControllerOptions shared_module_option;
+        std::string parameterPackage;
+        if (!parseModuleOptions(shared_module_list[i]["shared_module"], shared_module_option, parameterPackage)) {
           MELO_WARN("[RocomaRos] Shared module %d has missing or wrong-type entries. Skip module.", i);
           continue;
         }
+        const std::shared_future<std::string> packagePath = packagePathCache_.lookUp(parameterPackage);
+        prefetchLibrary([this, &shared_module_option]() {
+          return shared_module_option.isRos_ ? sharedModuleRosLoader_.getClassLibraryPath(shared_module_option.pluginName_)
+                                             : sharedModuleLoader_.getClassLibraryPath(shared_module_option.pluginName_);
+        });
+        pipeline.post([this, &secondsSince, &makeParameterPath, shared_module_option, packagePath]() {
+          const rocoma::TimingClock::time_point stepStart = rocoma::TimingClock::now();
+          ManagedModuleOptions sharedModuleOption(shared_module_option);
+          makeParameterPath(packagePath, sharedModuleOption.parameterPath_);
+          MELO_INFO(
+              "[RocomaRos] Got shared module %s successfully from the parameter server. \n (is_ros: %s, complete parameter_path: %s!)",
+              sharedModuleOption.pluginName_.c_str(), sharedModuleOption.isRos_ ? "true" : "false",
+              sharedModuleOption.parameterPath_.c_str());
+          this->setupSharedModules({sharedModuleOption});
+          startupReport_.sharedModulesTime_ += secondsSince(stepStart);
+        });
       }
     }
   }
 
-  // Setup shared modules
-  this->setupSharedModules(shared_module_option_list);
-
-  // Parse controller list
-  std::vector<ManagedControllerOptionsPair> controller_option_pairs;
-  ManagedControllerOptionsPair controller_option_pair;
+  // Setup controller pairs, the instantiated pairs are created whenever the parser has not posted the next pair yet
   XmlRpc::XmlRpcValue controller_pair_list;
-  XmlRpc::XmlRpcValue controller;
   if (!nodeHandle_.getParam("controller_manager/controller_pairs", controller_pair_list)) {
     MELO_WARN("[RocomaRos] Could not load parameter 'controller_manager/controller_pairs'. Add only failproof controller.");
+  } else if (controller_pair_list.getType() != XmlRpc::XmlRpcValue::TypeArray) {
+    MELO_WARN("[RocomaRos] Parameter 'controller_manager/controller_pairs' is not of array type. Add only failproof controller.");
   } else {
-    if (controller_pair_list.getType() == XmlRpc::XmlRpcValue::TypeArray) {
-      for (int i = 0; i < controller_pair_list.size(); ++i) {
-        // Check that controller_pair exists
-        if (controller_pair_list[i].getType() != XmlRpc::XmlRpcValue::TypeStruct || !controller_pair_list[i].hasMember("controller_pair") ||
-            controller_pair_list[i]["controller_pair"].getType() != XmlRpc::XmlRpcValue::TypeStruct) {
-          MELO_WARN("[RocomaRos] Controllerpair no %d can not be obtained. Skip controller pair.", i);
-          continue;
-        }
+    for (int i = 0; i < controller_pair_list.size(); ++i) {
+      // Check that controller_pair exists
+      if (controller_pair_list[i].getType() != XmlRpc::XmlRpcValue::TypeStruct || !controller_pair_list[i].hasMember("controller_pair") ||
+          controller_pair_list[i]["controller_pair"].getType() != XmlRpc::XmlRpcValue::TypeStruct) {
+        MELO_WARN("[RocomaRos] Controllerpair no %d can not be obtained. Skip controller pair.", i);
+        continue;
+      }
+      XmlRpc::XmlRpcValue& controller_pair = controller_pair_list[i]["controller_pair"];
 
-        // Check if controller exists
-        if (controller_pair_list[i]["controller_pair"].hasMember("controller") &&
-            controller_pair_list[i]["controller_pair"]["controller"].getType() == XmlRpc::XmlRpcValue::TypeStruct) {
-          controller = controller_pair_list[i]["controller_pair"]["controller"];
-        } else {
-          MELO_WARN("[RocomaRos] Controllerpair no %d has no or wrong-typed member controller. Skip controller pair.", i);
-          continue;
-        }
+      // Check if controller exists
+      if (!controller_pair.hasMember("controller") || controller_pair["controller"].getType() != XmlRpc::XmlRpcValue::TypeStruct) {
+        MELO_WARN("[RocomaRos] Controllerpair no %d has no or wrong-typed member controller. Skip controller pair.", i);
+        continue;
+      }
 
-        // Check for data members
-        if (controller.hasMember("plugin_name") && controller["plugin_name"].getType() == XmlRpc::XmlRpcValue::TypeString &&
-            controller.hasMember("name") && controller["name"].getType() == XmlRpc::XmlRpcValue::TypeString &&
-            controller.hasMember("is_ros") && controller["is_ros"].getType() == XmlRpc::XmlRpcValue::TypeBoolean &&
-            controller.hasMember("parameter_package") && controller["parameter_package"].getType() == XmlRpc::XmlRpcValue::TypeString &&
-            controller.hasMember("parameter_path") && controller["parameter_path"].getType() == XmlRpc::XmlRpcValue::TypeString) {
-          controller_option_pair.first.pluginName_ = static_cast<std::string>(controller["plugin_name"]);
-          controller_option_pair.first.name_ = static_cast<std::string>(controller["name"]);
-          controller_option_pair.first.isRos_ = static_cast<bool>(controller["is_ros"]);
-          std::string parameterPackage = static_cast<std::string>(controller["parameter_package"]);
-          if (!parameterPackage.empty()) {
-            parameterPackage = ros::package::getPath(parameterPackage);
-          }
-          controller_option_pair.first.parameterPath_ = parameterPackage + "/" + static_cast<std::string>(controller["parameter_path"]);
-          XmlRpc::XmlRpcValue shared_modules;
-          controller_option_pair.first.sharedModuleNames_.clear();
-          if (controller.hasMember("shared_modules") && controller["shared_modules"].getType() == XmlRpc::XmlRpcValue::TypeArray) {
-            for (int j = 0; j < controller["shared_modules"].size(); ++j) {
-              if (controller["shared_modules"][j].getType() == XmlRpc::XmlRpcValue::TypeString) {
-                controller_option_pair.first.sharedModuleNames_.push_back(controller["shared_modules"][j]);
-              }
-            }
-          }
-          MELO_INFO(
-              "[RocomaRos] Got controller plugin %s with controller name %s successfully from the parameter server. \n (is_ros: %s, "
-              "complete parameter_path: %s!)",
-              controller_option_pair.first.pluginName_.c_str(), controller_option_pair.first.name_.c_str(),
-              controller_option_pair.first.isRos_ ? "true" : "false", controller_option_pair.first.parameterPath_.c_str());
-        } else {
-          MELO_WARN("[RocomaRos] Subentry 'controller' of controllerpair no %d has missing or wrong-type entries. Skip controller.", i);
-          continue;
-        }
+      ManagedControllerOptionsPair controller_option_pair;
+      std::pair<std::string, std::string> parameterPackages;
+      if (!parseModuleOptions(controller_pair["controller"], controller_option_pair.first, parameterPackages.first)) {
+        MELO_WARN("[RocomaRos] Subentry 'controller' of controllerpair no %d has missing or wrong-type entries. Skip controller.", i);
+        continue;
+      }
 
-        // Parse emergency stop controller
-        if (controller_pair_list[i]["controller_pair"].hasMember("emergency_controller") &&
-            controller_pair_list[i]["controller_pair"]["emergency_controller"].getType() == XmlRpc::XmlRpcValue::TypeStruct) {
-          controller = controller_pair_list[i]["controller_pair"]["emergency_controller"];
-        } else {
-          MELO_INFO("[RocomaRos] Controllerpair no %d has no member emergency_controller. Add failproof controller instead.", i);
-          controller_option_pair.second = ManagedControllerOptions();
-          controller_option_pairs.push_back(controller_option_pair);
-          continue;
-        }
+      // Parse emergency stop controller
+      if (!controller_pair.hasMember("emergency_controller") ||
+          controller_pair["emergency_controller"].getType() != XmlRpc::XmlRpcValue::TypeStruct) {
+        MELO_INFO("[RocomaRos] Controllerpair no %d has no member emergency_controller. Add failproof controller instead.", i);
+      } else if (!parseModuleOptions(controller_pair["emergency_controller"], controller_option_pair.second, parameterPackages.second)) {
+        MELO_WARN(
+            "[RocomaRos] Subentry 'emergency_controller' of controllerpair no %d has missing or wrong-type entries. Add failproof "
+            "controller instead.",
+            i);
+        controller_option_pair.second = ManagedControllerOptions();
+        parameterPackages.second.clear();
+      }
 
-        if (controller.hasMember("plugin_name") && controller["plugin_name"].getType() == XmlRpc::XmlRpcValue::TypeString &&
-            controller.hasMember("name") && controller["name"].getType() == XmlRpc::XmlRpcValue::TypeString &&
-            controller.hasMember("is_ros") && controller["is_ros"].getType() == XmlRpc::XmlRpcValue::TypeBoolean &&
-            controller.hasMember("parameter_package") && controller["parameter_package"].getType() == XmlRpc::XmlRpcValue::TypeString &&
-            controller.hasMember("parameter_path") && controller["parameter_path"].getType() == XmlRpc::XmlRpcValue::TypeString) {
-          controller_option_pair.second.pluginName_ = static_cast<std::string>(controller["plugin_name"]);
-          controller_option_pair.second.name_ = static_cast<std::string>(controller["name"]);
-          controller_option_pair.second.isRos_ = static_cast<bool>(controller["is_ros"]);
-          controller_option_pair.second.parameterPath_ = ros::package::getPath(static_cast<std::string>(controller["parameter_package"])) +
-                                                         "/" + static_cast<std::string>(controller["parameter_path"]);
-          XmlRpc::XmlRpcValue shared_modules;
-          controller_option_pair.second.sharedModuleNames_.clear();
-          if (controller.hasMember("shared_modules") && controller["shared_modules"].getType() == XmlRpc::XmlRpcValue::TypeArray) {
-            for (int j = 0; j < controller["shared_modules"].size(); ++j) {
-              if (controller["shared_modules"][j].getType() == XmlRpc::XmlRpcValue::TypeString) {
-                controller_option_pair.second.sharedModuleNames_.push_back(controller["shared_modules"][j]);
-              }
-            }
-          }
+      const std::shared_future<std::string> controllerPackagePath = packagePathCache_.lookUp(parameterPackages.first);
+      const std::shared_future<std::string> emgcyControllerPackagePath = packagePathCache_.lookUp(parameterPackages.second);
+      const ManagedControllerOptions& controller = controller_option_pair.first;
+      prefetchLibrary([this, &controller]() {
+        return controller.isRos_ ? controllerRosLoader_.getClassLibraryPath(controller.pluginName_)
+                                 : controllerLoader_.getClassLibraryPath(controller.pluginName_);
+      });
+      const ManagedControllerOptions& emgcyController = controller_option_pair.second;
+      if (!emgcyController.name_.empty()) {
+        prefetchLibrary([this, &emgcyController]() {
+          return emgcyController.isRos_ ? emergencyControllerRosLoader_.getClassLibraryPath(emgcyController.pluginName_)
+                                        : emergencyControllerLoader_.getClassLibraryPath(emgcyController.pluginName_);
+        });
+      }
+      pipeline.post([this, &success, &secondsSince, &makeParameterPath, &controllerPairs, &pipeline, controller_option_pair,
+                     controllerPackagePath, emgcyControllerPackagePath, state, command, mutexState, mutexCommand]() {
+        const rocoma::TimingClock::time_point stepStart = rocoma::TimingClock::now();
+        ManagedControllerOptionsPair controllerOptionPair(controller_option_pair);
+        makeParameterPath(controllerPackagePath, controllerOptionPair.first.parameterPath_);
+        MELO_INFO(
+            "[RocomaRos] Got controller plugin %s with controller name %s successfully from the parameter server. \n (is_ros: %s, "
+            "complete parameter_path: %s!)",
+            controllerOptionPair.first.pluginName_.c_str(), controllerOptionPair.first.name_.c_str(),
+            controllerOptionPair.first.isRos_ ? "true" : "false", controllerOptionPair.first.parameterPath_.c_str());
+        if (!controllerOptionPair.second.name_.empty()) {
+          makeParameterPath(emgcyControllerPackagePath, controllerOptionPair.second.parameterPath_);
           MELO_INFO(
-              "[RocomaRos] Got controller plugin %s with controller name %s successfully from the parameter server.\n(is_ros: %s, complete "
-              "parameter_path: %s!",
-              controller_option_pair.second.name_.c_str(), controller_option_pair.second.name_.c_str(),
-              controller_option_pair.second.isRos_ ? "true" : "false", controller_option_pair.second.parameterPath_.c_str());
+              "[RocomaRos] Got controller plugin %s with controller name %s successfully from the parameter server.\n(is_ros: %s, "
+              "complete parameter_path: %s!",
+              controllerOptionPair.second.pluginName_.c_str(), controllerOptionPair.second.name_.c_str(),
+              controllerOptionPair.second.isRos_ ? "true" : "false", controllerOptionPair.second.parameterPath_.c_str());
+        }
+        ControllerPairPtr controllerPair;
+        if (instantiateControllerPair(controllerOptionPair, state, command, mutexState, mutexCommand, controllerPair)) {
+          controllerPairs.push_back(std::move(controllerPair));
         } else {
-          MELO_WARN(
-              "[RocomaRos] Subentry 'emergency_controller' of controllerpair no %d has missing or wrong-type entries. Add failproof "
-              "controller instead.",
-              i);
-          controller_option_pair.second = ManagedControllerOptions();
+          success = false;
         }
-
-        controller_option_pairs.push_back(controller_option_pair);
-      }
-    } else {
-      MELO_WARN("[RocomaRos] Parameter 'controller_manager/controller_pairs' is not of array type. Add only failproof controller.");
-      controller_option_pairs.clear();
+        // A batch of pairs is created on up to maxCreationThreads threads
+        if (pipeline.isIdle()) {
+          success = createControllerPairs(std::move(controllerPairs)) && success;
+          controllerPairs.clear();
+        }
+        startupReport_.controllersTime_ += secondsSince(stepStart);
+      });
     }
   }
+  startupReport_.parseTime_ = secondsSince(start);
+
+  // Create the pairs instantiated after the last check
+  pipeline.post([this, &success, &controllerPairs]() {
+    success = createControllerPairs(std::move(controllerPairs)) && success;
+    controllerPairs.clear();
+  });
+  pipeline.finish();
+  for (auto& prefetch : prefetches) {
+    prefetch.wait();
+  }
+  startupReport_.numPackageLookups_ = packagePathCache_.getNumLookups();
+  startupReport_.numPrefetchedLibraries_ = static_cast<unsigned int>(prefetches.size());
+  startupReport_.totalTime_ = secondsSince(start);
 
-  return setupControllers(failproofControllerName, controller_option_pairs, state, command, mutexState, mutexCommand);
+  MELO_INFO(
+      "[RocomaRos] Setup from parameter server took %f s (parse: %f s, waiting for packages: %f s, %u lookups, %u prefetched libraries, "
+      "failproof controller: %f s, shared modules: %f s, controllers: %f s).",
+      startupReport_.totalTime_, startupReport_.parseTime_, startupReport_.resolvePackagesTime_, startupReport_.numPackageLookups_,
+      startupReport_.numPrefetchedLibraries_, startupReport_.failproofControllerTime_, startupReport_.sharedModulesTime_,
+      startupReport_.controllersTime_);
+
+  return success;
 }
 
 template <typename State_, typename Command_>
@@ -558,6 +897,21 @@ bool ControllerManagerRos<State_, Command_>::getActiveControllerService(rocoma_m
   return true;
 }
 
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::reloadControllerService(rocoma_msgs::ReloadController::Request& req,
+                                                                     rocoma_msgs::ReloadController::Response& res) {
+  // This is another ros-thread anyway so this operation can be blocking until the controller is replaced
+  res.success = this->reloadController(req.name, req.plugin_name, &res.message);
+  return true;
+}
+
+template <typename State_, typename Command_>
+bool ControllerManagerRos<State_, Command_>::getStatisticsService(rocoma_msgs::GetStatistics::Request& req,
+                                                                  rocoma_msgs::GetStatistics::Response& res) {
+  fillStatisticsMsg(res.statistics);
+  return true;
+}
+
 template <typename State_, typename Command_>
 void ControllerManagerRos<State_, Command_>::notifyEmergencyStop(rocoma::ControllerManager::EmergencyStopType type) {
   publishEmergencyState(true);
@@ -605,4 +959,60 @@ void ControllerManagerRos<State_, Command_>::publishEmergencyState(bool trigger)
   emergencyStopStatePublisher_.publish(emergencyStopStateMsg_);
 }
 
+template <typename State_, typename Command_>
+void ControllerManagerRos<State_, Command_>::publishStatistics(const ros::TimerEvent& /*event*/) {
+  if (statisticsPublisher_.getNumSubscribers() == 0u) {
+    return;
+  }
+
+  // Fill msg
+  fillStatisticsMsg(statisticsMsg_);
+
+  // Publish message
+  statisticsPublisher_.publish(statisticsMsg_);
+}
+
+template <typename State_, typename Command_>
+void ControllerManagerRos<State_, Command_>::fillStatisticsMsg(rocoma_msgs::ControllerManagerStatistics& statisticsMsg) const {
+  const auto toMsg = [](const rocoma::LatencyStatistics& statistics, rocoma_msgs::LatencyStatistics& msg) {
+    msg.count = statistics.count;
+    msg.overruns = statistics.overruns;
+    msg.last = statistics.last;
+    msg.mean = statistics.mean;
+    msg.max = statistics.max;
+    msg.p50 = statistics.p50;
+    msg.p90 = statistics.p90;
+    msg.p99 = statistics.p99;
+    msg.p999 = statistics.p999;
+  };
+
+  const rocoma::ControllerManagerStatistics statistics = this->getStatistics();
+  statisticsMsg.stamp = ros::Time::now();
+  statisticsMsg.tick_count = statistics.tickCount_;
+  toMsg(statistics.updateController_, statisticsMsg.update_controller);
+  toMsg(statistics.updateControllerLockWait_, statisticsMsg.update_controller_lock_wait);
+  toMsg(statistics.switchController_, statisticsMsg.switch_controller);
+  toMsg(statistics.emergencyStop_, statisticsMsg.emergency_stop);
+  statisticsMsg.controllers.resize(statistics.controllers_.size());
+  for (std::size_t i = 0u; i < statistics.controllers_.size(); ++i) {
+    statisticsMsg.controllers[i].name = statistics.controllers_[i].controllerName_;
+    statisticsMsg.controllers[i].num_ticks = statistics.controllers_[i].numTicks_;
+    toMsg(statistics.controllers_[i].advanceController_, statisticsMsg.controllers[i].advance_controller);
+  }
+}
+
+template <typename State_, typename Command_>
+template <typename Controller>
+void ControllerManagerRos<State_, Command_>::setupCommandChannel(Controller* controller) {
+  if (commandChannel_ == nullptr) {
+    return;
+  }
+  auto channelController = dynamic_cast<rocoma::CommandChannelInterface<Command_>*>(controller);
+  if (channelController == nullptr) {
+    MELO_WARN("[RocomaRos] Controller does not support command channels. It only writes the command container.");
+    return;
+  }
+  channelController->setCommandChannel(commandChannel_);
+}
+
 }  // namespace rocoma_ros
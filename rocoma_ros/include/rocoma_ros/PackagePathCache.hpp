@@ -0,0 +1,92 @@
+#pragma once
+
+// ros
+#include <ros/package.h>
+
+// stl
+#include <future>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace rocoma_ros {
+
+//! Cache of the paths of ros packages
+/*! ros::package::getPath can crawl the ros package path on every call. The cache looks every package up once, packages that were
+ *  not found are remembered with an empty path. The mutex only guards the table, distinct packages are looked up concurrently and
+ *  callers asking for a package that is being looked up wait for that lookup. All functions are thread safe.
+ */
+class PackagePathCache {
+ public:
+  PackagePathCache() : paths_(), numLookups_(0u), mutex_() {}
+
+  /*! Looks up all packages that are not cached yet concurrently, every distinct package once
+   * @param packageNames  names of the packages (empty names are ignored)
+   */
+  void resolve(const std::vector<std::string>& packageNames) {
+    std::vector<std::shared_future<std::string>> paths;
+    paths.reserve(packageNames.size());
+    for (const auto& packageName : packageNames) {
+      paths.push_back(lookUp(packageName));
+    }
+    for (const auto& path : paths) {
+      path.wait();
+    }
+  }
+
+  /*! Starts looking up a package on a separate thread, unless it is cached or already being looked up
+   * @param packageName  name of the package
+   * @returns future path of the package (empty if the package name is empty or the package was not found)
+   */
+  std::shared_future<std::string> lookUp(const std::string& packageName) { return findPath(packageName, std::launch::async); }
+
+  /*! Get the path of a package, looked up on the calling thread on the first call
+   * @param packageName  name of the package
+   * @returns path of the package (empty if the package name is empty or the package was not found)
+   */
+  std::string getPath(const std::string& packageName) { return findPath(packageName, std::launch::deferred).get(); }
+
+  //! @returns number of calls to ros::package::getPath
+  unsigned int getNumLookups() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return numLookups_;
+  }
+
+  //! Forgets all paths, e.g. after packages were built or moved (waits for running lookups outside of the lock)
+  void clear() {
+    std::unordered_map<std::string, std::shared_future<std::string>> paths;
+    std::lock_guard<std::mutex> lock(mutex_);
+    paths_.swap(paths);
+  }
+
+ private:
+  /*! Finds the path of a package in the table or adds its lookup
+   * @param packageName  name of the package
+   * @param policy       launch policy of a new lookup
+   * @returns future path of the package
+   */
+  std::shared_future<std::string> findPath(const std::string& packageName, std::launch policy) {
+    if (packageName.empty()) {
+      std::promise<std::string> emptyPath;
+      emptyPath.set_value(std::string());
+      return emptyPath.get_future().share();
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto path = paths_.find(packageName);
+    if (path == paths_.end()) {
+      ++numLookups_;
+      path = paths_.emplace(packageName, std::async(policy, [packageName]() { return ros::package::getPath(packageName); }).share()).first;
+    }
+    return path->second;
+  }
+
+  //! Paths by package name (ready, being looked up or deferred to the first caller)
+  std::unordered_map<std::string, std::shared_future<std::string>> paths_;
+  //! Number of calls to ros::package::getPath
+  unsigned int numLookups_;
+  //! Mutex protecting the table (not held while looking up)
+  mutable std::mutex mutex_;
+};
+
+}  // namespace rocoma_ros
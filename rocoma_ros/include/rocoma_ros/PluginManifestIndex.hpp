@@ -0,0 +1,182 @@
+#pragma once
+
+// message logger
+#include "message_logger/message_logger.hpp"
+
+// ros
+#include <ros/package.h>
+
+// posix
+#include <sys/stat.h>
+
+// stl
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace rocoma_ros {
+
+//! Index of the plugin description files exported for rocoma_plugin, shared by all class loaders
+/*! Without an index every pluginlib::ClassLoader crawls the export manifests of all packages. The index is crawled once per process.
+ *  If the environment variable ROCOMA_PLUGIN_MANIFEST_CACHE names a file, the index is persisted there. It is keyed by ROS_PACKAGE_PATH
+ *  and the modification times of its roots, and stores the modification time of every description file. The cache is rebuilt when the
+ *  package path or a root changes (e.g. a package is added to or removed from a root) or a listed description file changed or is
+ *  missing. Packages added deeper below a root are not detected, delete the file after adding such a package. The file must not lie
+ *  directly in a root, writing it would invalidate the key. An empty crawl is never cached, it usually means that the environment is
+ *  not sourced.
+ */
+class PluginManifestIndex {
+ public:
+  //! @returns plugin description files of rocoma_plugin (crawled or read from the cache file on the first call, thread safe)
+  static const std::vector<std::string>& getPluginXmlPaths() {
+    static const std::vector<std::string> pluginXmlPaths = buildIndex();
+    return pluginXmlPaths;
+  }
+
+  /*! Crawls the manifests again, e.g. to find the plugins of packages built after the start, and updates the cache file.
+   *  getPluginXmlPaths keeps returning the index of the start.
+   * @returns plugin description files of rocoma_plugin
+   */
+  static std::vector<std::string> crawlPluginXmlPaths() {
+    const char* cacheFileName = std::getenv("ROCOMA_PLUGIN_MANIFEST_CACHE");
+    const char* packagePath = std::getenv("ROS_PACKAGE_PATH");
+    return crawl(cacheFileName, packagePath != nullptr ? packagePath : "", true);
+  }
+
+  /*! Reads shared libraries concurrently into the page cache, the class loaders then load them without waiting for the disk
+   * @param libraryPaths  paths of the shared libraries (empty paths are ignored)
+   * @returns futures of the reads (the caller waits for them, reads of missing files finish immediately)
+   */
+  static std::vector<std::future<void>> prefetchLibraries(const std::vector<std::string>& libraryPaths) {
+    std::vector<std::future<void>> prefetches;
+    prefetches.reserve(libraryPaths.size());
+    for (const auto& libraryPath : libraryPaths) {
+      if (libraryPath.empty()) {
+        continue;
+      }
+      prefetches.push_back(std::async(std::launch::async, [libraryPath]() {
+        std::ifstream library(libraryPath, std::ios::binary);
+        std::vector<char> buffer(1u << 16u);
+        while (library.read(buffer.data(), buffer.size()) || library.gcount() > 0) {
+        }
+      }));
+    }
+    return prefetches;
+  }
+
+ private:
+  //! Reads the index from the cache file or crawls the manifests (and updates the cache file)
+  static std::vector<std::string> buildIndex() {
+    const char* cacheFileName = std::getenv("ROCOMA_PLUGIN_MANIFEST_CACHE");
+    const char* packagePath = std::getenv("ROS_PACKAGE_PATH");
+    const std::string key = makeKey(packagePath != nullptr ? packagePath : "");
+
+    std::vector<std::string> pluginXmlPaths;
+    if (cacheFileName != nullptr && readCacheFile(cacheFileName, key, pluginXmlPaths)) {
+      MELO_DEBUG("[RocomaRos] Read %zu rocoma plugin manifests from %s.", pluginXmlPaths.size(), cacheFileName);
+      return pluginXmlPaths;
+    }
+
+    return crawl(cacheFileName, packagePath != nullptr ? packagePath : "", false);
+  }
+
+  /*! Crawls the manifests and writes the cache file (if configured and anything was found)
+   * @param cacheFileName  name of the cache file (nullptr -> not cached)
+   * @param packagePath    ROS_PACKAGE_PATH
+   * @param forceRecrawl   bypass the crawl cache of rospack, e.g. to find packages built after the start
+   * @returns plugin description files of rocoma_plugin
+   */
+  static std::vector<std::string> crawl(const char* cacheFileName, const std::string& packagePath, bool forceRecrawl) {
+    std::vector<std::string> pluginXmlPaths;
+    ros::package::getPlugins("rocoma_plugin", "plugin", pluginXmlPaths, forceRecrawl);
+    if (pluginXmlPaths.empty()) {
+      MELO_WARN("[RocomaRos] Found no rocoma plugin manifests in ROS_PACKAGE_PATH '%s'. Is the workspace sourced? The index is not cached.",
+                packagePath.c_str());
+      return pluginXmlPaths;
+    }
+    if (cacheFileName != nullptr) {
+      writeCacheFile(cacheFileName, makeKey(packagePath), pluginXmlPaths);
+    }
+    return pluginXmlPaths;
+  }
+
+  /*! Makes the key of the cache file
+   * @param packagePath  ROS_PACKAGE_PATH
+   * @returns package path followed by the modification time of every root
+   */
+  static std::string makeKey(const std::string& packagePath) {
+    std::string key = packagePath;
+    std::istringstream roots(packagePath);
+    std::string root;
+    while (std::getline(roots, root, ':')) {
+      if (!root.empty()) {
+        key += ' ' + getModificationTime(root);
+      }
+    }
+    return key;
+  }
+
+  /*! Get the modification time of a file or directory
+   * @param path  path of the file or directory
+   * @returns modification time as seconds.nanoseconds (empty if the path does not exist)
+   */
+  static std::string getModificationTime(const std::string& path) {
+    struct stat status {};
+    if (stat(path.c_str(), &status) != 0) {
+      return std::string();
+    }
+    return std::to_string(status.st_mtim.tv_sec) + "." + std::to_string(status.st_mtim.tv_nsec);
+  }
+
+  /*! Reads the cache file (first line: key, then the modification time and the path of one description file per line)
+   * @returns true iff the file exists, matches the key, lists at least one description file and none of them changed
+   */
+  static bool readCacheFile(const std::string& fileName, const std::string& key, std::vector<std::string>& pluginXmlPaths) {
+    std::ifstream file(fileName);
+    std::string line;
+    if (!std::getline(file, line) || line != key) {
+      return false;
+    }
+    while (std::getline(file, line)) {
+      if (line.empty()) {
+        continue;
+      }
+      const std::size_t separator = line.find(' ');
+      if (separator == std::string::npos) {
+        return false;
+      }
+      const std::string pluginXmlPath = line.substr(separator + 1u);
+      const std::string modificationTime = getModificationTime(pluginXmlPath);
+      if (modificationTime.empty() || line.compare(0u, separator, modificationTime) != 0) {
+        return false;
+      }
+      pluginXmlPaths.push_back(pluginXmlPath);
+    }
+    return !pluginXmlPaths.empty();
+  }
+
+  //! Writes the cache file (replaced atomically, concurrent launches read either the old or the new index)
+  static void writeCacheFile(const std::string& fileName, const std::string& key, const std::vector<std::string>& pluginXmlPaths) {
+    const std::string temporaryFileName = fileName + ".tmp";
+    {
+      std::ofstream file(temporaryFileName);
+      file << key << '\n';
+      for (const auto& pluginXmlPath : pluginXmlPaths) {
+        file << getModificationTime(pluginXmlPath) << ' ' << pluginXmlPath << '\n';
+      }
+      if (!file.good()) {
+        MELO_WARN("[RocomaRos] Could not write rocoma plugin manifest cache %s.", fileName.c_str());
+        return;
+      }
+    }
+    if (std::rename(temporaryFileName.c_str(), fileName.c_str()) != 0) {
+      MELO_WARN("[RocomaRos] Could not write rocoma plugin manifest cache %s.", fileName.c_str());
+    }
+  }
+};
+
+}  // namespace rocoma_ros
@@ -0,0 +1,100 @@
+#pragma once
+
+// stl
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace rocoma_ros {
+
+//! Runs setup steps on a second thread in the order they are posted
+/*! setupControllersFromParameterServer posts the setup of every entry as soon as it is parsed, so the plugins are instantiated and
+ *  created while the rest of the parameter server is parsed. The steps run one after the other. If a step throws, the remaining
+ *  steps are skipped and finish() rethrows the exception.
+ */
+class SetupPipeline {
+ public:
+  SetupPipeline() : steps_(), isFinishing_(false), exception_(), mutex_(), stepPosted_(), thread_(&SetupPipeline::run, this) {}
+  ~SetupPipeline() { join(); }
+
+  SetupPipeline(const SetupPipeline&) = delete;
+  SetupPipeline& operator=(const SetupPipeline&) = delete;
+
+  /*! Appends a step
+   * @param step  step to run on the setup thread
+   */
+  void post(std::function<void()> step) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      steps_.push_back(std::move(step));
+    }
+    stepPosted_.notify_one();
+  }
+
+  //! @returns true iff no posted step is waiting (called from a step: it is the last step posted so far)
+  bool isIdle() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return steps_.empty();
+  }
+
+  //! Runs the remaining steps and joins the setup thread, rethrows the exception of a failed step
+  void finish() {
+    join();
+    if (exception_) {
+      std::rethrow_exception(exception_);
+    }
+  }
+
+ private:
+  //! Lets the setup thread run the remaining steps and joins it
+  void join() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      isFinishing_ = true;
+    }
+    stepPosted_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  //! Setup thread, runs the steps until finish is called and all steps ran
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      stepPosted_.wait(lock, [this]() { return isFinishing_ || !steps_.empty(); });
+      if (steps_.empty()) {
+        return;
+      }
+      std::function<void()> step = std::move(steps_.front());
+      steps_.pop_front();
+      lock.unlock();
+      // Only the setup thread writes the exception until it is joined
+      if (!exception_) {
+        try {
+          step();
+        } catch (...) {
+          exception_ = std::current_exception();
+        }
+      }
+      lock.lock();
+    }
+  }
+
+  //! Steps waiting for the setup thread
+  std::deque<std::function<void()>> steps_;
+  //! True, iff no more steps are posted
+  bool isFinishing_;
+  //! Exception of the first failed step
+  std::exception_ptr exception_;
+  //! Mutex protecting the steps
+  mutable std::mutex mutex_;
+  std::condition_variable stepPosted_;
+  //! Setup thread (started last)
+  std::thread thread_;
+};
+
+}  // namespace rocoma_ros